@@ -0,0 +1,119 @@
+/**
+ * @file flash_store.c
+ * @brief Flash页上的追加式记录存储
+ *
+ * 每条记录为：头(0xA5xx，低字节为数据半字数) + 数据 + CRC16，按半字编程。
+ * 新记录追加在上一条之后，读取时取最后一条校验通过的记录；页写满才擦除，
+ * 以减少擦除次数（F103单页约1万次擦写寿命）。
+ */
+#include "flash_store.h"
+#include "crc16.h"
+#include <string.h>
+
+#define FLASH_STORE_MAGIC  0xA500U
+#define FLASH_STORE_ERASED 0xFFFFU
+
+// 记录占用的字节数（头 + 数据 + CRC，数据按半字对齐）
+static uint32_t record_size(uint16_t len)
+{
+    return 2U + ((len + 1U) & ~1U) + 2U;
+}
+
+// 记录位置是否完全处于擦除状态
+static uint8_t slot_erased(uint32_t addr, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i += 2U)
+    {
+        if (*(volatile uint16_t *) (addr + i) != FLASH_STORE_ERASED) return 0;
+    }
+    return 1;
+}
+
+// 查找最后一条指定长度的有效记录，并返回可写入的空闲地址（无空闲时为页尾）
+static uint32_t flash_store_scan(uint32_t page, uint16_t len, uint32_t *free_addr)
+{
+    uint32_t last = 0;
+    uint32_t addr = page;
+    uint32_t end = page + FLASH_STORE_SIZE;
+    uint32_t size = record_size(len);
+    uint16_t header = FLASH_STORE_MAGIC | ((len + 1U) / 2U);
+
+    while (addr + size <= end)
+    {
+        uint16_t head = *(volatile uint16_t *) addr;
+        if (head == header)
+        {
+            const uint8_t *data = (const uint8_t *) (addr + 2U);
+            uint16_t       crc = *(volatile uint16_t *) (addr + size - 2U);
+            if (Modbus_CRC16(data, len) == crc) last = addr;
+        }
+        else if (head == FLASH_STORE_ERASED)
+        {
+            if (slot_erased(addr, size)) break; // 空闲位置
+            // 否则为写入中途掉电的残留记录（记录头最后写入），跳过
+        }
+        else
+        {
+            addr = end; // 其他格式的记录，整页视为已满
+            break;
+        }
+        addr += size;
+    }
+
+    *free_addr = (addr + size <= end) ? addr : end;
+    return last;
+}
+
+HAL_StatusTypeDef flash_store_read(uint32_t page, void *data, uint16_t len)
+{
+    uint32_t free_addr;
+    uint32_t addr = flash_store_scan(page, len, &free_addr);
+
+    if (addr == 0) return HAL_ERROR;
+    memcpy(data, (const void *) (addr + 2U), len);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef flash_store_write(uint32_t page, const void *data, uint16_t len)
+{
+    uint32_t          addr;
+    HAL_StatusTypeDef ret = HAL_OK;
+
+    if (record_size(len) > FLASH_STORE_SIZE) return HAL_ERROR;
+    flash_store_scan(page, len, &addr);
+
+    HAL_FLASH_Unlock();
+
+    // 剩余空间不足时擦除整页
+    if (addr + record_size(len) > page + FLASH_STORE_SIZE)
+    {
+        FLASH_EraseInitTypeDef erase = {0};
+        uint32_t               page_error = 0;
+
+        erase.TypeErase = FLASH_TYPEERASE_PAGES;
+        erase.PageAddress = page;
+        erase.NbPages = 1;
+        ret = HAL_FLASHEx_Erase(&erase, &page_error);
+        addr = page;
+    }
+
+    // 先写数据和CRC，最后写记录头，掉电时半条记录不会被识别为有效
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint32_t       data_addr = addr + 2U;
+    for (uint16_t i = 0; i < len && ret == HAL_OK; i += 2U)
+    {
+        uint16_t half = bytes[i] | ((i + 1U < len) ? (uint16_t) (bytes[i + 1] << 8) : 0xFF00U);
+        ret = HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, data_addr + i, half);
+    }
+    if (ret == HAL_OK)
+    {
+        ret = HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, addr + record_size(len) - 2U, Modbus_CRC16(bytes, len));
+    }
+    if (ret == HAL_OK)
+    {
+        ret = HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, addr, FLASH_STORE_MAGIC | ((len + 1U) / 2U));
+    }
+
+    HAL_FLASH_Lock();
+    return ret;
+}
@@ -0,0 +1,46 @@
+#ifndef FLASH_STORE_H
+#define FLASH_STORE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*----------------------------------include-----------------------------------*/
+#include "main.h"
+/*-----------------------------------macro------------------------------------*/
+// 持久化存储使用Flash最后两页（链接脚本中已从FLASH区域扣除），每页只存放一种记录
+#define FLASH_STORE_SIZE       0x400UL      // 页大小
+#define FLASH_STORE_STATS_PAGE 0x0800FC00UL // 加热累计统计
+#define FLASH_STORE_CAL_PAGE   0x0800F800UL // NTC校准
+/*----------------------------------typedef-----------------------------------*/
+
+/*----------------------------------variable----------------------------------*/
+
+/*-------------------------------------os-------------------------------------*/
+
+/*----------------------------------function----------------------------------*/
+/**
+ * @brief 读取最近一次保存的记录
+ * @param page 存储页地址（FLASH_STORE_xxx_PAGE）
+ * @param data 输出缓冲区
+ * @param len 记录长度（字节，需与写入时一致）
+ * @return HAL_OK: 读取成功；HAL_ERROR: 无有效记录
+ */
+HAL_StatusTypeDef flash_store_read(uint32_t page, void *data, uint16_t len);
+
+/**
+ * @brief 追加保存一条记录（页写满时擦除后从页首重新写入）
+ * @param page 存储页地址（FLASH_STORE_xxx_PAGE）
+ * @param data 记录数据
+ * @param len 记录长度（字节）
+ * @note 编程/擦除期间CPU取指暂停（擦除约20ms），不可在中断中调用
+ */
+HAL_StatusTypeDef flash_store_write(uint32_t page, const void *data, uint16_t len);
+/*------------------------------------test------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLASH_STORE_H */
@@ -1,36 +1,124 @@
 #include "heat.h"
+#include "ntc.h"
 #include "stm32f103xb.h"
 #include "tim.h"
 
+// 各加热区输出：均使用TIM1（共用1kHz周期），区0为原加热片PA11/CH4，
+// 区1、区2为多区硬件版本新增的CH1(PA8)、CH3(PA10)
+typedef struct
+{
+    uint32_t channel;
+    uint16_t pin;
+} HeatZoneOutput;
+
+static const HeatZoneOutput heat_zone_output[HEAT_ZONE_MAX] = {
+    {TIM_CHANNEL_4, GPIO_PIN_11},
+    {TIM_CHANNEL_1, GPIO_PIN_8},
+    {TIM_CHANNEL_3, GPIO_PIN_10},
+};
+
+// 占空比小数部分累积（Q16，单位：计数值），每次更新带入下一次，形成一阶sigma-delta
+static uint32_t heat_duty_residual[HEAT_ZONE_NUM] = {0};
+
+// 故障锁存：置位后所有输出保持关闭，直到heat_fault_clear
+static volatile HeatFault heat_fault = HEAT_FAULT_NONE;
+
+// 内部函数：设置比较值；写入后再检查故障锁存，避免与中断中的关断交错时重新打开输出。
+// 比较值不超过NTC_PulseMax，关断沿不落入NTC扫描窗口（PWM同步触发时最大占空比3区约88.5%、单区约93.3%）
+static void heat_set_pulse(uint8_t zone, uint32_t pulse)
+{
+    uint32_t pulse_max = NTC_PulseMax();
+
+    if (pulse > pulse_max) pulse = pulse_max;
+    __HAL_TIM_SET_COMPARE(&htim1, heat_zone_output[zone].channel, pulse);
+    if (heat_fault != HEAT_FAULT_NONE) { __HAL_TIM_SET_COMPARE(&htim1, heat_zone_output[zone].channel, 0); }
+}
+
 void heat_init(void)
 {
     GPIO_InitTypeDef GPIO_InitStruct = {0};
     GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
     GPIO_InitStruct.Pull = GPIO_PULLDOWN;
     GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
-    GPIO_InitStruct.Pin = GPIO_PIN_11;
-    HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
-    // 初始化加热控制硬件
-    HAL_TIM_PWM_Start(&htim1, TIM_CHANNEL_4);
+
+    // 区0的通道由CubeMX配置，其余区按CH4的输出参数配置
+    TIM_OC_InitTypeDef sConfigOC = {0};
+    sConfigOC.OCMode = TIM_OCMODE_PWM1;
+    sConfigOC.Pulse = 0;
+    sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+    sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+    sConfigOC.OCIdleState = TIM_OCIDLESTATE_RESET;
+    sConfigOC.OCNIdleState = TIM_OCNIDLESTATE_RESET;
+
+    for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++)
+    {
+        GPIO_InitStruct.Pin = heat_zone_output[zone].pin;
+        HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+        if (zone > 0) { HAL_TIM_PWM_ConfigChannel(&htim1, &sConfigOC, heat_zone_output[zone].channel); }
+        // 初始化加热控制硬件
+        HAL_TIM_PWM_Start(&htim1, heat_zone_output[zone].channel);
+    }
 }
 
 void heat_deinit(void)
 {
     // 反初始化加热控制硬件
-    HAL_TIM_PWM_Stop(&htim1, TIM_CHANNEL_4);
+    for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++) { HAL_TIM_PWM_Stop(&htim1, heat_zone_output[zone].channel); }
 }
 
-void heat_on(float power)
+void heat_on(uint8_t zone, float power)
 {
+    if (zone >= HEAT_ZONE_NUM) return;
+
     // 设置加热功率，power 范围为 0.0 到 100.0（百分比）
     if (power < 0.0f) power = 0.0f;
     if (power > 100.0f) power = 100.0f;
 
     uint32_t pulse = (uint32_t) ((power / 100.0f) * (__HAL_TIM_GET_AUTORELOAD(&htim1) + 1));
-    __HAL_TIM_SET_COMPARE(&htim1, TIM_CHANNEL_4, pulse);
+    heat_set_pulse(zone, pulse);
 }
-void heat_off(void)
+
+void heat_on_q16(uint8_t zone, q16_t power)
 {
+    if (zone >= HEAT_ZONE_NUM) return;
+
+    // 设置加热功率，power 为Q16.16百分比(0 到 100)，全程整数运算
+    // TIM1以64MHz计数、ARR=63999(1kHz)，单步约0.0016%；不足一个计数的部分由heat_duty_residual累积
+    power = q16_clamp(power, 0, Q16_FROM_INT(100));
+
+    uint32_t period = __HAL_TIM_GET_AUTORELOAD(&htim1) + 1;
+    uint64_t scaled = (uint64_t) power * period / 100U + heat_duty_residual[zone]; // Q16计数值
+    uint32_t pulse = (uint32_t) (scaled >> Q16_SHIFT);
+
+    heat_duty_residual[zone] = (uint32_t) scaled & (Q16_ONE - 1);
+    heat_set_pulse(zone, pulse);
+}
+
+void heat_off(uint8_t zone)
+{
+    if (zone >= HEAT_ZONE_NUM) return;
+
     // 关闭加热
-    __HAL_TIM_SET_COMPARE(&htim1, TIM_CHANNEL_4, 0);
+    heat_duty_residual[zone] = 0;
+    __HAL_TIM_SET_COMPARE(&htim1, heat_zone_output[zone].channel, 0);
+}
+
+// 紧急关断（可在任意优先级中断中调用）：先锁存故障再清零所有输出
+void heat_emergency_off(HeatFault fault)
+{
+    heat_fault = fault;
+    for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++)
+    {
+        __HAL_TIM_SET_COMPARE(&htim1, heat_zone_output[zone].channel, 0);
+    }
+}
+
+HeatFault heat_fault_get(void)
+{
+    return heat_fault;
+}
+
+void heat_fault_clear(void)
+{
+    heat_fault = HEAT_FAULT_NONE;
 }
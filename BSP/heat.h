@@ -9,10 +9,28 @@ extern "C"
 #endif
 
 /*----------------------------------include-----------------------------------*/
+#include "fixed.h"
 #include "main.h"
 /*-----------------------------------macro------------------------------------*/
+// 加热区数量（编译期配置，每区一个NTC和一路PWM输出）
+#define HEAT_ZONE_MAX 3
+#ifndef HEAT_ZONE_NUM
+#define HEAT_ZONE_NUM 1
+#endif
+#if HEAT_ZONE_NUM < 1 || HEAT_ZONE_NUM > HEAT_ZONE_MAX
+#error "HEAT_ZONE_NUM must be 1..HEAT_ZONE_MAX"
+#endif
+
+// 加热片最高允许温度（℃）：任一NTC超过该温度时由ADC模拟看门狗中断直接关断输出
+#define HEAT_MAX_PAD_TEMP 65
 
 /*----------------------------------typedef-----------------------------------*/
+// 加热故障（锁存，需显式清除）
+typedef enum
+{
+    HEAT_FAULT_NONE = 0,
+    HEAT_FAULT_OVERTEMP = 1 // 超温硬件关断
+} HeatFault;
 
 /*----------------------------------variable----------------------------------*/
 
@@ -21,8 +39,13 @@ extern "C"
 /*----------------------------------function----------------------------------*/
 void heat_init(void);
 void heat_deinit(void);
-void heat_on(float power);
-void heat_off(void);
+void heat_on(uint8_t zone, float power);
+void heat_on_q16(uint8_t zone, q16_t power);
+void heat_off(uint8_t zone);
+
+void      heat_emergency_off(HeatFault fault);
+HeatFault heat_fault_get(void);
+void      heat_fault_clear(void);
 /*------------------------------------test------------------------------------*/
 
 #ifdef __cplusplus
@@ -10,86 +10,127 @@
  */
 #include "key.h"
 
-#define KEY1_Input      HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_8)
-#define KEY2_Input      HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_3)
-#define KEY3_Input      HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_5)
-#define KEY4_Input      HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_4)
-#define KEY5_Input      HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_15)
+// 按键矩阵：6个引脚两两之间接按键（三角矩阵），每个引脚既作行又作列。
+// 空闲时全部为上拉输入；扫描某一行时将该引脚切换为推挽输出低电平，其后的引脚作为列，
+// 读到低电平即按键按下；多键同时按下时取最后扫描到的按键。
+// 行表常量存放在Flash，引脚模式在key_init中配置一次，扫描时只改写行引脚的4位配置，
+// 行电平由BSRR写入，每行每个端口只读一次IDR。
+//
+// 扫描耗时（64MHz）：以下均为按指令数估算，未在目标板上实测
+//   原实现：每次扫描20次HAL_GPIO_Init（每次遍历16个引脚位）及25次HAL读写，估算约6000周期（~95us）
+//   现实现：5行 × (配置改写 + BSRR + 2次IDR + 比较)约30周期，另加每行1us建立等待，估算约450周期（~7us）
+// 实测方法：KEY_SCAN_PROFILE置1后编译，调试器中查看key_scan_cycles（DWT->CYCCNT差值，含建立等待）
+#define KEY_SCAN_PROFILE 0 // 1：记录每次扫描耗时
 
-#define KEY6_Input      HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_3)
-#define KEY7_Input      HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_5)
-#define KEY8_Input      HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_4)
-#define KEY9_Input      HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_15)
+#define KEY_ROW_NUM       5
+#define KEY_COL_MAX       5
+#define KEY_SETTLE_US     1    // 行驱动后的建立时间（内部上拉约40kΩ，引脚电容约10pF）
+#define KEY_CR_INPUT_PULL 0x8U // CNF=10 MODE=00：上拉/下拉输入（ODR为1时上拉）
+#define KEY_CR_OUTPUT_PP  0x2U // CNF=00 MODE=10：推挽输出2MHz
 
-#define KEY10_Input     HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_4)
-#define KEY11_Input     HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_15)
-#define KEY12_Input     HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_5)
+// 两个端口的IDR合并为32位：高16位为GPIOA，低16位为GPIOB
+#define KEY_PA(pin) ((uint32_t) (pin) << 16)
+#define KEY_PB(pin) ((uint32_t) (pin))
 
-#define KEY14_Input     HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_4)
-#define KEY13_Input     HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_15)
+#define KEY_PINS_A GPIO_PIN_15
+#define KEY_PINS_B (GPIO_PIN_9 | GPIO_PIN_8 | GPIO_PIN_3 | GPIO_PIN_5 | GPIO_PIN_4)
 
-#define KEY15_Input     HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_15)
+// 行配置：行引脚均在GPIOB
+typedef struct
+{
+    uint8_t  row_pos;               // 行引脚序号
+    uint8_t  col_num;               // 本行列数
+    uint32_t col_mask[KEY_COL_MAX]; // 各列在合并IDR中的位
+    uint8_t  key[KEY_COL_MAX];      // 各列对应的键值
+} KeyRow;
+
+static const KeyRow key_rows[KEY_ROW_NUM] = {
+    {9,
+     5,
+     {KEY_PB(GPIO_PIN_8), KEY_PB(GPIO_PIN_3), KEY_PB(GPIO_PIN_5), KEY_PB(GPIO_PIN_4), KEY_PA(GPIO_PIN_15)},
+     {KEY_MUSIC, KEY_BLUETOOTH, KEY_PLAY_PAUSE, KEY_MIN10, KEY_MIN60}},
+    {8,
+     4,
+     {KEY_PB(GPIO_PIN_3), KEY_PB(GPIO_PIN_5), KEY_PB(GPIO_PIN_4), KEY_PA(GPIO_PIN_15)},
+     {KEY_PREV, KEY_NEXT, KEY_VOL_DOWN, KEY_VOL_UP}},
+    {3,
+     3,
+     {KEY_PB(GPIO_PIN_5), KEY_PB(GPIO_PIN_4), KEY_PA(GPIO_PIN_15)},
+     {KEY_SHORTCUT_1, KEY_HEAT_PLUS, KEY_HEAT_MINUS}},
+    {5, 2, {KEY_PB(GPIO_PIN_4), KEY_PA(GPIO_PIN_15)}, {KEY_MIN30, KEY_SHORTCUT_2}},
+    {4, 1, {KEY_PA(GPIO_PIN_15)}, {KEY_HEAT}},
+};
+
+static uint32_t key_settle_cycles = 0; // 建立等待周期数
+#if KEY_SCAN_PROFILE
+static volatile uint32_t key_scan_cycles = 0; // 最近一次扫描耗时（周期，调试器查看）
+#endif
+
+// 内部函数：改写GPIOB行引脚的配置位
+static void key_row_mode(uint8_t pos, uint32_t mode)
+{
+    volatile uint32_t *cr = (pos < 8) ? &GPIOB->CRL : &GPIOB->CRH;
+    uint32_t           shift = (pos & 7U) * 4U;
+
+    *cr = (*cr & ~(0xFUL << shift)) | (mode << shift);
+}
+
+void key_init(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    // 全部矩阵引脚配置为上拉输入（HAL同时将ODR置1）
+    GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+    GPIO_InitStruct.Pull = GPIO_PULLUP;
+    GPIO_InitStruct.Pin = KEY_PINS_B;
+    HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+    GPIO_InitStruct.Pin = KEY_PINS_A;
+    HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+    // 使能DWT周期计数器用于建立等待（不清零计数值，不影响时间戳服务）
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    key_settle_cycles = SystemCoreClock / 1000000U * KEY_SETTLE_US;
+}
 
-#define KEY_Power_Input HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_10)
 unsigned char get_key(void)
 {
-    if (HAL_GPIO_ReadPin(POWER_DC_GPIO_Port, POWER_DC_Pin) == 0)
+    if ((POWER_DC_GPIO_Port->IDR & POWER_DC_Pin) == 0)
     {
-        return 18; // 电源键
+        return KEY_POWER; // 电源键
     }
 
-    uint8_t          Mode = 0;
-    GPIO_InitTypeDef GPIO_InitStruct = {0};
-    __HAL_RCC_GPIOA_CLK_ENABLE();
-    __HAL_RCC_GPIOB_CLK_ENABLE();
+    uint8_t mode = KEY_NULL;
+#if KEY_SCAN_PROFILE
+    uint32_t start = DWT->CYCCNT;
+#endif
 
-    // 定义每一行的配置信息
-    typedef struct
+    for (uint8_t i = 0; i < KEY_ROW_NUM; i++)
     {
-        uint16_t outputPin;     // 输出引脚
-        uint16_t inputPins[5];  // 输入引脚列表
-        uint8_t  modeValues[5]; // 对应的按键模式值
-    } KeyRowConfig;
-
-    // 配置每一行的键盘设置
-    KeyRowConfig rows[] = {{GPIO_PIN_9, {GPIO_PIN_8, GPIO_PIN_3, GPIO_PIN_5, GPIO_PIN_4, GPIO_PIN_15}, {1, 2, 3, 4, 5}},
-                           {GPIO_PIN_8, {GPIO_PIN_3, GPIO_PIN_5, GPIO_PIN_4, GPIO_PIN_15, 0}, {6, 7, 8, 9, 0}},
-                           {GPIO_PIN_3, {GPIO_PIN_5, GPIO_PIN_4, GPIO_PIN_15, 0, 0}, {12, 10, 11, 0, 0}},
-                           {GPIO_PIN_5, {GPIO_PIN_4, GPIO_PIN_15, 0, 0, 0}, {14, 13, 0, 0, 0}},
-                           {GPIO_PIN_4, {GPIO_PIN_15, 0, 0, 0, 0}, {15, 0, 0, 0, 0}}};
-
-    // 遍历每一行的配置
-    for (uint8_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++)
-    {
-        // 配置输出引脚
-        GPIO_InitStruct.Pin = rows[i].outputPin;
-        GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
-        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
-        HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
-        HAL_GPIO_WritePin(GPIOB, rows[i].outputPin, GPIO_PIN_RESET);
-
-        // 配置输入引脚并检测按键
-        for (uint8_t j = 0; j < 5; j++)
+        const KeyRow *row = &key_rows[i];
+        uint32_t      pin = 1UL << row->row_pos;
+
+        // 先清ODR再切换为输出，行引脚直接输出低电平
+        GPIOB->BSRR = pin << 16;
+        key_row_mode(row->row_pos, KEY_CR_OUTPUT_PP);
+
+        // 等待列电平建立（上一行释放的列经上拉恢复高电平）
+        uint32_t t0 = DWT->CYCCNT;
+        while (DWT->CYCCNT - t0 < key_settle_cycles) {}
+
+        uint32_t level = (GPIOA->IDR << 16) | (GPIOB->IDR & 0xFFFFU);
+        for (uint8_t j = 0; j < row->col_num; j++)
         {
-            if (rows[i].inputPins[j] != 0)
-            {
-                GPIO_InitStruct.Pin = rows[i].inputPins[j];
-                GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
-                GPIO_InitStruct.Pull = GPIO_PULLUP;
-                HAL_GPIO_Init((rows[i].inputPins[j] == GPIO_PIN_15) ? GPIOA : GPIOB, &GPIO_InitStruct);
-
-                // 检测按键是否按下
-                if (HAL_GPIO_ReadPin((rows[i].inputPins[j] == GPIO_PIN_15) ? GPIOA : GPIOB, rows[i].inputPins[j]) ==
-                    GPIO_PIN_RESET)
-                {
-                    Mode = rows[i].modeValues[j];
-                }
-            }
+            if ((level & row->col_mask[j]) == 0) mode = row->key[j];
         }
 
-        // 释放当前行的输出引脚
-        HAL_GPIO_WritePin(GPIOB, rows[i].outputPin, GPIO_PIN_SET);
+        // 恢复上拉输入
+        key_row_mode(row->row_pos, KEY_CR_INPUT_PULL);
+        GPIOB->BSRR = pin;
     }
 
-    return Mode;
+#if KEY_SCAN_PROFILE
+    key_scan_cycles = DWT->CYCCNT - start;
+#endif
+    return mode;
 }
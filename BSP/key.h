@@ -38,6 +38,7 @@ typedef enum
 /*-------------------------------------os-------------------------------------*/
 
 /*----------------------------------function----------------------------------*/
+void          key_init(void);
 unsigned char get_key(void);
 /*------------------------------------test------------------------------------*/
 
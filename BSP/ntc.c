@@ -10,12 +10,61 @@
  */
 #include "ntc.h"
 #include "adc.h"
+#include "filter.h"
+#include "flash_store.h"
 #include "math.h"
+#include "ntc_table.h"
 #include "stm32f1xx_hal_adc.h"
+#include "tim.h"
 
-#define NTC_NUM 5
+// 定时器触发一次扫描（各区NTC及VREFINT），DMA循环搬运到两个缓冲块：
+// 半传输/传输完成中断分别表示前/后一块已写满，读取时取最新写满的一块，不再启停ADC和DMA
+// 触发源：
+//   PWM同步（默认）：TIM1 CC2在加热PWM周期内的固定相位触发，避开加热片开关沿，采样率等于PWM频率(1kHz)
+//   定速：TIM3更新事件(TRGO)按NTC_SAMPLE_RATE_HZ触发，与PWM不同步
+#define NTC_TRIGGER_PWM_SYNC 1       // 1：TIM1 CC2同步触发；0：TIM3定速触发
+#define NTC_SAMPLE_RATE_HZ   1000    // 定速触发采样速率（TIM3计数时钟1MHz，不低于16Hz）
+#define NTC_TIM_CLOCK_HZ     1000000 // TIM3计数时钟（64MHz / 64）
+#define NTC_NUM              64      // 每块每通道采样数即抽取倍数（1kHz下每块64ms）
+#define NTC_READ_RETRIES     3       // 读取期间该块被DMA覆盖时的重试次数
 
-uint32_t adc_raw[NTC_NUM]; // adc原始数据
+// 过采样抽取：每块去掉最小、最大各NTC_TRIM个样本（抑制尖峰干扰，为0时即块平均），
+// 其余样本求平均并保留NTC_OVERSAMPLE_BITS位小数；有效位数约为12 + log4(保留样本数)
+// 同步采样避开了开关噪声，只需剔除少量样本
+#if NTC_TRIGGER_PWM_SYNC
+#define NTC_TRIM 2 // 两端各剔除的样本数（须小于NTC_NUM / 2）
+#else
+#define NTC_TRIM 8
+#endif
+#define NTC_OVERSAMPLE_BITS 3 // 抽取结果附加的小数位（保留48个以上样本时约+2.8位）
+#define NTC_CODE_MAX        (ADC_MAX_VALUE << NTC_OVERSAMPLE_BITS) // 抽取结果最大值
+
+// 扫描序列：各区NTC依次排列，最后为内部参考电压VREFINT（用于计算VDDA及比例校正）
+#define NTC_CH_NUM     (NTC_SENSOR_NUM + 1)
+#define NTC_CH_VREFINT NTC_SENSOR_NUM
+#define VREFINT_MV     1200 // VREFINT典型值(mV)
+#define NTC_SUPPLY_MV  0    // NTC分压供电电压(mV)；0表示由VDDA供电，ADC读数本身即为比例值，无需校正
+
+// 同步触发相位由扫描时长推算：比较值取PWM周期末尾前一次扫描加余量处，扫描在更新事件（占空比装载、
+// 加热片导通沿）之前完成。ADC时钟为PCLK2/6，TIM1计数时钟为PCLK2，每个ADC周期对应6个TIM1计数
+#define NTC_ADC_CLOCK_DIV  6          // ADC时钟分频（与main.c中RCC_ADCPCLK2_DIV6一致）
+#define NTC_CONV_CYCLES_X2 (479 + 25) // 每通道采样239.5 + 转换12.5个ADC周期（×2取整，10.67MHz下约23.6us）
+#define NTC_SCAN_MARGIN    640        // 扫描结束到更新事件的余量（10us，覆盖触发延迟与DMA搬运）
+#define NTC_PWM_PERIOD     64000      // TIM1周期计数（与tim.c中Period = 64000-1一致）
+// 一次扫描的TIM1计数（3区4通道约6048，即94.5us）。加热输出的关断沿（CNT = CCRx）同样须避开扫描窗口，
+// 比较值上限见NTC_PulseMax
+#define NTC_SCAN_COUNTS (NTC_CH_NUM * NTC_CONV_CYCLES_X2 * NTC_ADC_CLOCK_DIV / 2)
+#if NTC_TRIGGER_PWM_SYNC && (NTC_SCAN_COUNTS + 2 * NTC_SCAN_MARGIN > NTC_PWM_PERIOD)
+#error "NTC scan does not fit in one heater PWM period, reduce the sampling time or the channel count"
+#endif
+
+// 各区NTC的ADC通道与引脚（区0为原PA5，区1、区2为多区硬件版本新增）
+static const uint32_t ntc_adc_channel[HEAT_ZONE_MAX] = {ADC_CHANNEL_5, ADC_CHANNEL_6, ADC_CHANNEL_4};
+static const uint16_t ntc_adc_pin[HEAT_ZONE_MAX] = {GPIO_PIN_5, GPIO_PIN_6, GPIO_PIN_4};
+
+static uint16_t          ntc_dma_buf[2][NTC_NUM][NTC_CH_NUM]; // DMA乒乓缓冲（扫描结果按通道交错）
+static volatile uint8_t  ntc_ready_block = 0;                 // 最新写满的缓冲块
+static volatile uint32_t ntc_block_seq = 0;                   // 已写满的缓冲块计数（为0表示尚无数据）
 
 // NTC参数配置
 #define NTC_RESISTANCE    10000 // NTC标称电阻值(Ω)
@@ -24,48 +73,99 @@ uint32_t adc_raw[NTC_NUM]; // adc原始数据
 #define REFERENCE_VOLTAGE 3300  // 参考电压(mV)
 #define ADC_MAX_VALUE     4095  // ADC最大值(12位)
 
-void NTC_Init(void)
-{
-    HAL_ADC_Start_DMA(&hadc1, adc_raw, NTC_NUM);
-}
+// ADC码-温度查找表：每NTC_TABLE_STEP个ADC码一个节点，节点间线性插值
+#define NTC_TABLE_STEP_SHIFT 5                                             // 节点间隔32个ADC码
+#define NTC_TABLE_STEP       (1 << NTC_TABLE_STEP_SHIFT)
+#define NTC_TABLE_SIZE       ((ADC_MAX_VALUE >> NTC_TABLE_STEP_SHIFT) + 2) // 覆盖ADC码0~4096
+#define NTC_TABLE_FRAC       7                                             // 表项单位为1/128℃
+#define NTC_TABLE_LIMIT      (INT16_MAX >> NTC_TABLE_FRAC)                 // 表项温度上下限（℃）
+#define NTC_TEMP_MIN         Q16_FROM_INT(-20)                             // 有效测量范围下限
+#define NTC_TEMP_MAX         Q16_FROM_INT(100)                             // 有效测量范围上限
+
+// 标称表由Tools/ntc_table_gen.py离线生成（ntc_table.h），参数须与上面的配置一致
+#if NTC_TABLE_GEN_R0 != NTC_RESISTANCE || NTC_TABLE_GEN_BETA != NTC_BETA ||                                            \
+    NTC_TABLE_GEN_SERIES != SERIES_RESISTANCE || NTC_TABLE_GEN_ADC_MAX != ADC_MAX_VALUE ||                             \
+    NTC_TABLE_GEN_STEP_SHIFT != NTC_TABLE_STEP_SHIFT || NTC_TABLE_GEN_FRAC != NTC_TABLE_FRAC ||                        \
+    NTC_TABLE_GEN_SIZE != NTC_TABLE_SIZE
+#error "ntc_table.h does not match the NTC parameters, run: python3 Tools/ntc_table_gen.py"
+#endif
+
+static int16_t        ntc_cal_table[NTC_SENSOR_NUM][NTC_TABLE_SIZE]; // 校准后各区节点温度（1/128℃）
+static const int16_t *ntc_table[NTC_SENSOR_NUM];                     // 各区当前查找表（NULL表示尚未生成）
 
-// 冒泡排序函数，用于中值滤波
-static void bubble_sort(uint32_t *array, uint8_t size)
+// 两点校准：各区温度修正为 T = gain·T标称 + offset，修正在生成查找表时并入表项，读取时无额外开销
+#define NTC_CAL_MIN_SPAN  10.0f // 两个校准点的最小温差（℃）
+#define NTC_CAL_GAIN_MIN  0.9f  // 增益修正下限
+#define NTC_CAL_GAIN_MAX  1.1f  // 增益修正上限
+#define NTC_CAL_ERROR_MAX 5.0f  // 校准点处允许的最大修正量（℃）
+
+// 校准参数（保存在Flash，记录长度随区数变化，区数改变后旧记录自动失效）
+typedef struct
 {
-    for (uint8_t i = 0; i < size - 1; i++)
-    {
-        for (uint8_t j = 0; j < size - i - 1; j++)
-        {
-            if (array[j] > array[j + 1])
-            {
-                uint32_t temp = array[j];
-                array[j] = array[j + 1];
-                array[j + 1] = temp;
-            }
-        }
-    }
-}
+    float    gain[NTC_SENSOR_NUM];
+    float    offset[NTC_SENSOR_NUM];
+    uint32_t valid; // 0表示未校准（使用标称参数）
+} NtcCalibration;
+
+static NtcCalibration       ntc_cal;                     // 当前校准参数
+static float                ntc_cal_raw[NTC_SENSOR_NUM]; // 第一点各区的标称温度
+static float                ntc_cal_ref;                 // 第一点的参考温度
+static volatile NtcCalState ntc_cal_state = NTC_CAL_NONE;
+
+// 温度输出滤波链：先剔除偶发的跳变读数，再以3点中值平滑（仅处理有效读数）；
+// 同步采样时省去中值级，减少一个读数的延迟
+#define NTC_OUTLIER_THRESHOLD Q16_FROM_INT(2)                // 相邻读数跳变超过该值视为野值（℃）
+#define NTC_OUTLIER_MAX       3                              // 连续剔除次数上限（超过后视为真实变化）
+#define NTC_MEDIAN_SIZE       3                              // 中值窗口
+#define NTC_CHAIN_STAGES      (NTC_TRIGGER_PWM_SYNC ? 1 : 2) // 参与滤波的级数
+
+static FilterStage ntc_stages[NTC_SENSOR_NUM][2];
+static FilterChain ntc_chain[NTC_SENSOR_NUM];
 
-// 中值滤波函数
-static uint32_t median_filter(uint32_t *data_buffer, uint8_t size)
+// 抽取：一块原始样本合成为一个带NTC_OVERSAMPLE_BITS位小数的ADC码
+// 单遍累加全部样本，同时以插入方式维护最小、最大各NTC_TRIM个样本，最后从总和中扣除，
+// 结果与整块排序后截尾求和相同。多数样本只与两个数组的边界各比较一次
+static uint32_t ntc_decimate(const uint16_t *block)
 {
-    uint32_t sorted_data[NTC_NUM];
+    uint32_t sum = 0;
+#if NTC_TRIM > 0
+    uint16_t low[NTC_TRIM], high[NTC_TRIM]; // low升序、high降序，末项为当前剔除边界
 
-    // 复制数据到临时数组
-    for (uint8_t i = 0; i < size; i++)
+    for (uint8_t j = 0; j < NTC_TRIM; j++)
     {
-        sorted_data[i] = data_buffer[i];
+        low[j] = UINT16_MAX;
+        high[j] = 0;
     }
+#endif
 
-    // 排序
-    bubble_sort(sorted_data, size);
+    for (uint8_t i = 0; i < NTC_NUM; i++)
+    {
+        uint16_t x = block[i];
 
-    // 返回中值
-    return sorted_data[size / 2];
+        sum += x;
+#if NTC_TRIM > 0
+        uint8_t j;
+        if (x < low[NTC_TRIM - 1])
+        {
+            for (j = NTC_TRIM - 1; j > 0 && low[j - 1] > x; j--) { low[j] = low[j - 1]; }
+            low[j] = x;
+        }
+        if (x > high[NTC_TRIM - 1])
+        {
+            for (j = NTC_TRIM - 1; j > 0 && high[j - 1] < x; j--) { high[j] = high[j - 1]; }
+            high[j] = x;
+        }
+#endif
+    }
+
+#if NTC_TRIM > 0
+    for (uint8_t j = 0; j < NTC_TRIM; j++) { sum -= low[j] + high[j]; }
+#endif
+    return (sum << NTC_OVERSAMPLE_BITS) / (NTC_NUM - 2 * NTC_TRIM);
 }
 
 // 根据ADC值计算NTC电阻值
-static float calculate_ntc_resistance(uint32_t adc_value)
+static float calculate_ntc_resistance(float adc_value)
 {
     if (adc_value >= ADC_MAX_VALUE)
     {
@@ -74,7 +174,7 @@ static float calculate_ntc_resistance(uint32_t adc_value)
 
     // 计算NTC电阻值
     // R = R_series * (ADC_max / ADC_value - 1)
-    return (float) SERIES_RESISTANCE * ((float) ADC_MAX_VALUE / (float) adc_value - 1.0f);
+    return (float) SERIES_RESISTANCE * ((float) ADC_MAX_VALUE / adc_value - 1.0f);
 }
 
 // 根据NTC电阻值计算温度(℃)
@@ -95,21 +195,345 @@ static float calculate_temperature(float resistance)
     return temp_kelvin - 273.15f;
 }
 
-// 读取NTC温度
-int NTC_Read(float *temperature)
+// 内部函数：温度对应的ADC码（Beta方程反算，用于模拟看门狗阈值）
+static uint32_t ntc_temperature_to_adc(float temperature)
 {
-    int ret = 0;
+    static const float T0 = 298.15f;
 
-    HAL_ADC_Stop_DMA(&hadc1); // 停止DMA
-    // 中值滤波
-    uint32_t filtered_adc = median_filter(adc_raw, NTC_NUM);
-    // 计算NTC电阻值
-    float ntc_resistance = calculate_ntc_resistance(filtered_adc);
-    // 计算温度
-    *temperature = calculate_temperature(ntc_resistance);
-
-    // 重新启动DMA
-    HAL_ADC_Start_DMA(&hadc1, adc_raw, NTC_NUM);
-    if (*temperature < -20 || *temperature > 100) { ret = -1; }
-    return ret;
+    float resistance = NTC_RESISTANCE * expf(NTC_BETA * (1.0f / (temperature + 273.15f) - 1.0f / T0));
+    return (uint32_t) (ADC_MAX_VALUE * (float) SERIES_RESISTANCE / (resistance + SERIES_RESISTANCE));
+}
+
+// 内部函数：超温看门狗阈值。各区按校准参数反算HEAT_MAX_PAD_TEMP对应的标称温度，
+// 看门狗对全部通道共用一个阈值，取各区中最低的ADC码
+static uint32_t ntc_watchdog_threshold(void)
+{
+    uint32_t threshold = ADC_MAX_VALUE;
+
+    for (uint8_t i = 0; i < NTC_SENSOR_NUM; i++)
+    {
+        float nominal = HEAT_MAX_PAD_TEMP;
+        if (ntc_cal.valid) nominal = (HEAT_MAX_PAD_TEMP - ntc_cal.offset[i]) / ntc_cal.gain[i];
+
+        uint32_t code = ntc_temperature_to_adc(nominal);
+        if (code < threshold) threshold = code;
+    }
+    return threshold;
+}
+
+// 内部函数：按区数配置扫描序列（CubeMX只配置了区0的单通道）
+static void ntc_scan_config(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+    GPIO_InitStruct.Mode = GPIO_MODE_ANALOG;
+    for (uint8_t i = 1; i < NTC_SENSOR_NUM; i++)
+    {
+        GPIO_InitStruct.Pin = ntc_adc_pin[i];
+        HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+    }
+
+    hadc1.Init.ScanConvMode = ADC_SCAN_ENABLE;
+    hadc1.Init.NbrOfConversion = NTC_CH_NUM;
+    hadc1.Init.ExternalTrigConv = NTC_TRIGGER_PWM_SYNC ? ADC_EXTERNALTRIGCONV_T1_CC2 : ADC_EXTERNALTRIGCONV_T3_TRGO;
+    if (HAL_ADC_Init(&hadc1) != HAL_OK) { Error_Handler(); }
+
+    // VREFINT要求采样时间不少于17.1us，239.5个周期(10.67MHz下22.4us)满足要求
+    ADC_ChannelConfTypeDef sConfig = {0};
+    sConfig.SamplingTime = ADC_SAMPLETIME_239CYCLES_5;
+    for (uint8_t ch = 0; ch < NTC_CH_NUM; ch++)
+    {
+        sConfig.Channel = (ch == NTC_CH_VREFINT) ? ADC_CHANNEL_VREFINT : ntc_adc_channel[ch];
+        sConfig.Rank = ADC_REGULAR_RANK_1 + ch;
+        if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK) { Error_Handler(); }
+    }
+
+    // 模拟看门狗监视全部规则通道：温度越高ADC码越大，任一NTC超过HEAT_MAX_PAD_TEMP即触发；
+    // VREFINT读数约为满量程的36%，低于阈值，不会误触发；NTC短路（满量程）同样触发关断
+    ADC_AnalogWDGConfTypeDef awd = {0};
+    awd.WatchdogMode = ADC_ANALOGWATCHDOG_ALL_REG;
+    awd.HighThreshold = ntc_watchdog_threshold();
+    awd.LowThreshold = 0;
+    awd.ITMode = ENABLE;
+    if (HAL_ADC_AnalogWDGConfig(&hadc1, &awd) != HAL_OK) { Error_Handler(); }
+
+    // 中断中不调用RTOS接口，使用最高优先级，不受任务调度和临界区屏蔽影响
+    HAL_NVIC_SetPriority(ADC1_2_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(ADC1_2_IRQn);
+}
+
+void NTC_Init(void)
+{
+    // 加载校准参数（无记录或已清除时使用标称参数）后生成查找表
+    if (flash_store_read(FLASH_STORE_CAL_PAGE, &ntc_cal, sizeof(ntc_cal)) != HAL_OK) ntc_cal.valid = 0;
+    ntc_cal_state = ntc_cal.valid ? NTC_CAL_DONE : NTC_CAL_NONE;
+    NTC_TableInit();
+    for (uint8_t i = 0; i < NTC_SENSOR_NUM; i++)
+    {
+        filter_outlier_init(&ntc_stages[i][0], NTC_OUTLIER_THRESHOLD, NTC_OUTLIER_MAX);
+        filter_median_init(&ntc_stages[i][1], NTC_MEDIAN_SIZE);
+        ntc_chain[i].stages = ntc_stages[i];
+        ntc_chain[i].num = NTC_CHAIN_STAGES;
+    }
+    ntc_scan_config();
+    HAL_ADC_Start_DMA(&hadc1, (uint32_t *) ntc_dma_buf, 2 * NTC_NUM * NTC_CH_NUM);
+
+#if NTC_TRIGGER_PWM_SYNC
+    // TIM1 CH2仅用作触发（PA9不是复用输出，引脚不受影响），比较值决定采样相位
+    TIM_OC_InitTypeDef sConfigOC = {0};
+    sConfigOC.OCMode = TIM_OCMODE_PWM1;
+    sConfigOC.Pulse = __HAL_TIM_GET_AUTORELOAD(&htim1) + 1 - NTC_SCAN_COUNTS - NTC_SCAN_MARGIN;
+    sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+    sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+    sConfigOC.OCIdleState = TIM_OCIDLESTATE_RESET;
+    sConfigOC.OCNIdleState = TIM_OCNIDLESTATE_RESET;
+    if (HAL_TIM_PWM_ConfigChannel(&htim1, &sConfigOC, TIM_CHANNEL_2) != HAL_OK) { Error_Handler(); }
+    HAL_TIM_PWM_Start(&htim1, TIM_CHANNEL_2);
+#else
+    // 设置采样速率并启动TIM3（仅输出TRGO，不开更新中断）
+    __HAL_TIM_SET_AUTORELOAD(&htim3, NTC_TIM_CLOCK_HZ / NTC_SAMPLE_RATE_HZ - 1);
+    HAL_TIM_Base_Start(&htim3);
+#endif
+}
+
+// DMA半传输回调：前一块写满
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc->Instance == ADC1)
+    {
+        ntc_ready_block = 0;
+        ntc_block_seq++;
+    }
+}
+
+// DMA传输完成回调：后一块写满（循环模式下DMA自动回到前一块）
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc->Instance == ADC1)
+    {
+        ntc_ready_block = 1;
+        ntc_block_seq++;
+    }
+}
+
+// 模拟看门狗回调：直接关断所有加热输出并锁存故障；
+// 超温期间每次转换都会置位看门狗标志，因此关闭看门狗中断，清除故障时重新使能
+void HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc->Instance == ADC1)
+    {
+        heat_emergency_off(HEAT_FAULT_OVERTEMP);
+        __HAL_ADC_DISABLE_IT(hadc, ADC_IT_AWD);
+    }
+}
+
+// 重新使能超温看门狗（清除故障后调用；若仍超温将在下一次转换时再次关断）
+void NTC_WatchdogRearm(void)
+{
+    __HAL_ADC_CLEAR_FLAG(&hadc1, ADC_FLAG_AWD);
+    __HAL_ADC_ENABLE_IT(&hadc1, ADC_IT_AWD);
+}
+
+// 按各区校准参数生成查找表：未校准时直接使用Flash中的标称表，校准后由标称表逐项修正到RAM，
+// 均不需要软浮点logf；每次读取只需查表插值
+void NTC_TableInit(void)
+{
+    for (uint8_t s = 0; s < NTC_SENSOR_NUM; s++)
+    {
+        if (!ntc_cal.valid)
+        {
+            ntc_table[s] = ntc_nominal_table;
+            continue;
+        }
+
+        for (uint16_t i = 0; i < NTC_TABLE_SIZE; i++)
+        {
+            // 端点为开路/短路限值，不做校准修正
+            float temperature = (float) ntc_nominal_table[i] / (1 << NTC_TABLE_FRAC);
+            if (i > 0 && i < NTC_TABLE_SIZE - 1) temperature = ntc_cal.gain[s] * temperature + ntc_cal.offset[s];
+
+            if (temperature < -NTC_TABLE_LIMIT) temperature = -NTC_TABLE_LIMIT;
+            if (temperature > NTC_TABLE_LIMIT) temperature = NTC_TABLE_LIMIT;
+            ntc_cal_table[s][i] = (int16_t) lroundf(temperature * (1 << NTC_TABLE_FRAC));
+        }
+        ntc_table[s] = ntc_cal_table[s];
+    }
+}
+
+// 过采样ADC码换算为温度（查表线性插值，不访问硬件；NTC_TableInit之前返回-1）
+// code带NTC_OVERSAMPLE_BITS位小数，插值结果直接以Q16.16输出，保留过采样带来的分辨率
+int NTC_AdcToTemperature(uint8_t sensor, uint32_t code, q16_t *temperature)
+{
+    if (sensor >= NTC_SENSOR_NUM || ntc_table[sensor] == NULL) return -1;
+    if (code > NTC_CODE_MAX) code = NTC_CODE_MAX;
+
+    const int16_t *table = ntc_table[sensor];
+    uint32_t index = code >> (NTC_TABLE_STEP_SHIFT + NTC_OVERSAMPLE_BITS);
+    int32_t  frac = (int32_t) (code & ((NTC_TABLE_STEP << NTC_OVERSAMPLE_BITS) - 1));
+    int32_t  lo = table[index];
+    int32_t  diff = table[index + 1] - lo;
+
+    // 表项为1/128℃，左移到Q16.16后再按插值比例缩放（64位乘法避免溢出）
+    *temperature = (q16_t) (lo * (1 << (Q16_SHIFT - NTC_TABLE_FRAC)) +
+                            (((int64_t) diff * frac << (Q16_SHIFT - NTC_TABLE_FRAC)) >>
+                             (NTC_TABLE_STEP_SHIFT + NTC_OVERSAMPLE_BITS)));
+    if (*temperature < NTC_TEMP_MIN || *temperature > NTC_TEMP_MAX) { return -1; }
+    return 0;
+}
+
+// 内部函数：复制最新写满一块中指定通道的样本
+// 复制期间若又有块写满，则该块可能已被DMA覆盖，重新复制
+static int ntc_copy_channel(uint8_t ch, uint16_t *samples)
+{
+    uint32_t seq;
+    uint8_t  retries = NTC_READ_RETRIES;
+
+    do
+    {
+        seq = ntc_block_seq;
+        if (seq == 0) return -1; // 尚未采满一块
+
+        const volatile uint16_t(*src)[NTC_CH_NUM] = ntc_dma_buf[ntc_ready_block];
+        for (uint8_t i = 0; i < NTC_NUM; i++) { samples[i] = src[i][ch]; }
+    } while (seq != ntc_block_seq && --retries > 0);
+
+    return (seq == ntc_block_seq) ? 0 : -1;
+}
+
+// 读取VDDA电压（mV，由VREFINT换算）
+int NTC_ReadVdda(uint16_t *mv)
+{
+    uint16_t samples[NTC_NUM];
+    uint32_t sum = 0;
+
+    if (ntc_copy_channel(NTC_CH_VREFINT, samples) != 0) return -1;
+    for (uint8_t i = 0; i < NTC_NUM; i++) { sum += samples[i]; }
+    if (sum == 0) return -1;
+
+    *mv = (uint16_t) ((uint32_t) VREFINT_MV * ADC_MAX_VALUE * NTC_NUM / sum);
+    return 0;
+}
+
+// 内部函数：读取指定区最新一块样本抽取后的过采样ADC码
+static int ntc_read_code(uint8_t sensor, uint32_t *code)
+{
+    uint16_t samples[NTC_NUM];
+
+    if (sensor >= NTC_SENSOR_NUM || ntc_copy_channel(sensor, samples) != 0) return -1;
+
+    // 过采样抽取
+    *code = ntc_decimate(samples);
+#if NTC_SUPPLY_MV > 0
+    // 分压电源与ADC参考不同源时，按VDDA/供电电压换算为比例值
+    uint16_t vdda_mv;
+    if (NTC_ReadVdda(&vdda_mv) != 0) return -1;
+    *code = *code * vdda_mv / NTC_SUPPLY_MV;
+#endif
+    return 0;
+}
+
+// 读取指定区的NTC温度（最新一块样本抽取后的结果）
+int NTC_Read(uint8_t sensor, q16_t *temperature)
+{
+    uint32_t code;
+
+    if (ntc_read_code(sensor, &code) != 0) return -1;
+
+    // 换算温度，有效读数再经输出滤波链
+    if (NTC_AdcToTemperature(sensor, code, temperature) != 0) return -1;
+    filter_chain_process(&ntc_chain[sensor], temperature, temperature, 1);
+    return 0;
+}
+
+// 加热输出允许的最大比较值：关断沿在触发点前至少NTC_SCAN_MARGIN，不落入扫描窗口。
+// 3区时为64000 - 6048 - 2×640 = 56672（最大占空比约88.5%），单区为59696（约93.3%）；定速触发时不限制
+uint32_t NTC_PulseMax(void)
+{
+#if NTC_TRIGGER_PWM_SYNC
+    return __HAL_TIM_GET_AUTORELOAD(&htim1) + 1 - NTC_SCAN_COUNTS - 2 * NTC_SCAN_MARGIN;
+#else
+    return __HAL_TIM_GET_AUTORELOAD(&htim1) + 1;
+#endif
+}
+
+// 清除各区输出滤波链状态，下一个有效读数重新初始化（中值窗口、野值基准不再含停止前的旧读数）
+void NTC_FilterReset(void)
+{
+    for (uint8_t i = 0; i < NTC_SENSOR_NUM; i++) { filter_chain_reset(&ntc_chain[i]); }
+}
+
+// 内部函数：启用校准参数，重新生成查找表和看门狗阈值；滤波链中为旧参数下的读数，一并复位
+static void ntc_cal_apply(const NtcCalibration *cal)
+{
+    ntc_cal = *cal;
+    NTC_TableInit();
+    WRITE_REG(hadc1.Instance->HTR, ntc_watchdog_threshold());
+    NTC_FilterReset();
+}
+
+// 两点校准采集：各区处于同一参考温度（如恒温水槽中）时调用，记录当前读数对应的标称温度；
+// 第二点采集后计算各区增益和偏移，保存并重新生成查找表。失败时保留原校准参数
+int NTC_CalCapture(uint8_t point, q16_t reference)
+{
+    float raw[NTC_SENSOR_NUM];
+    float ref = Q16_TO_FLOAT(reference);
+
+    // 以标称参数换算（与当前校准无关），开路/短路读数无效
+    for (uint8_t i = 0; i < NTC_SENSOR_NUM; i++)
+    {
+        uint32_t code;
+        if (ntc_read_code(i, &code) != 0 || code == 0 || code >= NTC_CODE_MAX)
+        {
+            ntc_cal_state = NTC_CAL_FAILED;
+            return -1;
+        }
+        raw[i] = calculate_temperature(calculate_ntc_resistance((float) code / (1 << NTC_OVERSAMPLE_BITS)));
+    }
+
+    if (point == 1)
+    {
+        for (uint8_t i = 0; i < NTC_SENSOR_NUM; i++) { ntc_cal_raw[i] = raw[i]; }
+        ntc_cal_ref = ref;
+        ntc_cal_state = NTC_CAL_POINT1;
+        return 0;
+    }
+
+    // 第二点：两点连线即为修正关系，温差过小或修正量超出元件公差范围时视为操作错误
+    NtcCalibration cal = {.valid = 1};
+    uint8_t        ok = (point == 2 && ntc_cal_state == NTC_CAL_POINT1);
+    for (uint8_t i = 0; i < NTC_SENSOR_NUM && ok; i++)
+    {
+        float span = raw[i] - ntc_cal_raw[i];
+        if (fabsf(span) < NTC_CAL_MIN_SPAN || fabsf(ref - ntc_cal_ref) < NTC_CAL_MIN_SPAN) ok = 0;
+        else
+        {
+            cal.gain[i] = (ref - ntc_cal_ref) / span;
+            cal.offset[i] = ntc_cal_ref - cal.gain[i] * ntc_cal_raw[i];
+            ok = (cal.gain[i] >= NTC_CAL_GAIN_MIN && cal.gain[i] <= NTC_CAL_GAIN_MAX &&
+                  fabsf(ntc_cal_ref - ntc_cal_raw[i]) <= NTC_CAL_ERROR_MAX && fabsf(ref - raw[i]) <= NTC_CAL_ERROR_MAX);
+        }
+    }
+    if (!ok || flash_store_write(FLASH_STORE_CAL_PAGE, &cal, sizeof(cal)) != HAL_OK)
+    {
+        ntc_cal_state = NTC_CAL_FAILED;
+        return -1;
+    }
+
+    ntc_cal_apply(&cal);
+    ntc_cal_state = NTC_CAL_DONE;
+    return 0;
+}
+
+// 清除校准，恢复标称参数
+void NTC_CalClear(void)
+{
+    NtcCalibration cal = {0};
+
+    if (ntc_cal.valid) flash_store_write(FLASH_STORE_CAL_PAGE, &cal, sizeof(cal));
+    ntc_cal_apply(&cal);
+    ntc_cal_state = NTC_CAL_NONE;
+}
+
+NtcCalState NTC_CalGetState(void)
+{
+    return ntc_cal_state;
 }
@@ -7,10 +7,21 @@ extern "C"
 #endif
 
 /*----------------------------------include-----------------------------------*/
+#include "fixed.h"
+#include "heat.h"
 #include "main.h"
 /*-----------------------------------macro------------------------------------*/
+#define NTC_SENSOR_NUM HEAT_ZONE_NUM // 每个加热区一个NTC
 
 /*----------------------------------typedef-----------------------------------*/
+// 两点校准状态
+typedef enum
+{
+    NTC_CAL_NONE = 0, // 未校准（标称参数）
+    NTC_CAL_POINT1,   // 已采集第一点，等待第二点
+    NTC_CAL_DONE,     // 已校准
+    NTC_CAL_FAILED    // 采集或计算失败（读数无效、两点温差过小或修正量超限），保留原校准参数
+} NtcCalState;
 
 /*----------------------------------variable----------------------------------*/
 
@@ -18,7 +29,25 @@ extern "C"
 
 /*----------------------------------function----------------------------------*/
 void NTC_Init(void);
-int  NTC_Read(float *temperature);
+int  NTC_Read(uint8_t sensor, q16_t *temperature);
+void NTC_FilterReset(void);
+int  NTC_ReadVdda(uint16_t *mv);
+void NTC_WatchdogRearm(void);
+void NTC_TableInit(void);
+int  NTC_AdcToTemperature(uint8_t sensor, uint32_t code, q16_t *temperature);
+
+// 加热输出比较值上限（TIM1计数），关断沿避开同步触发的扫描窗口
+uint32_t NTC_PulseMax(void);
+
+/**
+ * @brief 两点校准采集（各区须处于同一参考温度；与NTC_Read在同一任务中调用）
+ * @param point 1: 第一点；2: 第二点（计算修正量并保存到Flash，擦写期间CPU暂停）
+ * @param reference 参考温度（Q16.16，℃），两点相差不小于10℃
+ * @return 0: 成功；-1: 失败（状态为NTC_CAL_FAILED）
+ */
+int         NTC_CalCapture(uint8_t point, q16_t reference);
+void        NTC_CalClear(void);
+NtcCalState NTC_CalGetState(void);
 /*------------------------------------test------------------------------------*/
 
 #ifdef __cplusplus
@@ -0,0 +1,36 @@
+/**
+ * @file ntc_table.h
+ * @brief NTC标称查找表（由Tools/ntc_table_gen.py生成，勿手工修改）
+ *
+ * 节点为Beta方程在每32个ADC码处的温度，单位1/128℃；端点为开路/短路限值。
+ * -20~100℃内相对Beta方程的插值误差：最大0.0745℃，RMS 0.0088℃（3位过采样码逐一比对）
+ */
+#ifndef NTC_TABLE_H
+#define NTC_TABLE_H
+
+#include <stdint.h>
+
+// 生成参数（ntc.c据此检查与自身配置一致）
+#define NTC_TABLE_GEN_R0         10000
+#define NTC_TABLE_GEN_BETA       3950
+#define NTC_TABLE_GEN_SERIES     10000
+#define NTC_TABLE_GEN_ADC_MAX    4095
+#define NTC_TABLE_GEN_STEP_SHIFT 5
+#define NTC_TABLE_GEN_FRAC       7
+#define NTC_TABLE_GEN_SIZE       129
+
+static const int16_t ntc_nominal_table[NTC_TABLE_GEN_SIZE] = {
+    -32640,  -7018,  -5891,  -5183,  -4655,  -4229,  -3869,  -3556,  -3276,  -3024,  -2793,  -2579,
+     -2379,  -2192,  -2015,  -1847,  -1687,  -1534,  -1387,  -1245,  -1109,   -976,   -848,   -724,
+      -602,   -484,   -368,   -255,   -145,    -36,     71,    175,    278,    380,    480,    579,
+       677,    773,    869,    964,   1057,   1150,   1242,   1334,   1425,   1515,   1605,   1695,
+      1784,   1873,   1962,   2050,   2138,   2227,   2315,   2403,   2491,   2579,   2667,   2756,
+      2844,   2933,   3022,   3112,   3201,   3292,   3382,   3474,   3566,   3658,   3751,   3845,
+      3940,   4035,   4131,   4229,   4327,   4427,   4527,   4629,   4733,   4837,   4943,   5051,
+      5161,   5272,   5385,   5500,   5617,   5737,   5859,   5984,   6112,   6242,   6376,   6513,
+      6654,   6799,   6948,   7102,   7261,   7425,   7595,   7771,   7954,   8145,   8345,   8553,
+      8772,   9003,   9246,   9504,   9778,  10071,  10386,  10726,  11096,  11502,  11951,  12453,
+     13023,  13680,  14456,  15399,  16594,  18212,  20662,  25425,  32640,
+};
+
+#endif /* NTC_TABLE_H */
@@ -15,14 +15,41 @@ typedef struct
     uint8_t weekday; // 0-6 (0=星期日, 6=星期六)
 } RTC_DateTimeTypeDef;
 
+// 异步计数器写入状态
+typedef enum
+{
+    RTC_WRITE_IDLE = 0, // 无写入或已完成
+    RTC_WRITE_PENDING,  // 新值已登记，等待RTOFF
+    RTC_WRITE_BUSY      // 已写入，等待备份域完成(RTOFF)
+} RTC_WriteState;
+
+// 时间边沿类型(数值越大越稀疏，订阅某一边沿也会在更高级边沿时被调用)
+typedef enum
+{
+    RTC_EDGE_SECOND = 0, // 每秒
+    RTC_EDGE_MINUTE,     // 每分钟整
+    RTC_EDGE_HOUR,       // 每小时整
+    RTC_EDGE_DAY         // 每天零点(或时间被重新设置)
+} RTC_TickEdge;
+
+// 时间边沿回调(在RTC秒中断上下文中执行)
+typedef void (*RTC_TickCallback)(const RTC_DateTimeTypeDef *now);
+
 // 外部函数声明
 HAL_StatusTypeDef RTC_Init(void);
 HAL_StatusTypeDef RTC_SetDateTime(RTC_DateTimeTypeDef *datetime);
 HAL_StatusTypeDef RTC_GetDateTime(RTC_DateTimeTypeDef *datetime);
 uint32_t          RTC_GetUTC(void);
+uint32_t          RTC_GetUTCSubSecond(uint32_t *sub_us);
 HAL_StatusTypeDef RTC_SetUTC(uint32_t utc);
+HAL_StatusTypeDef RTC_SetUTCAsync(uint32_t utc);
+HAL_StatusTypeDef RTC_SyncUTC(uint32_t utc);
+RTC_WriteState    RTC_GetWriteState(void);
+void              RTC_WriteService(void);
 void              RTC_UTCToDateTime(uint32_t utc, RTC_DateTimeTypeDef *datetime);
 uint32_t          RTC_DateTimeToUTC(RTC_DateTimeTypeDef *datetime);
+HAL_StatusTypeDef RTC_RegisterTickCallback(RTC_TickEdge edge, RTC_TickCallback callback);
+void              RTC_SecondIRQHandler(void);
 
 // 外部RTC句柄声明
 extern RTC_HandleTypeDef hrtc;
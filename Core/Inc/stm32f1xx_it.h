@@ -60,6 +60,8 @@ void TIM3_IRQHandler(void);
 void TIM4_IRQHandler(void);
 void USART3_IRQHandler(void);
 /* USER CODE BEGIN EFP */
+void RTC_IRQHandler(void);
+void ADC1_2_IRQHandler(void);
 
 /* USER CODE END EFP */
 
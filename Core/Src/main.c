@@ -28,6 +28,7 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "rtc.h"
+#include "timestamp.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -83,7 +84,7 @@ int main(void)
     HAL_Init();
 
     /* USER CODE BEGIN Init */
-    // RTC_Init();
+
     /* USER CODE END Init */
 
     /* Configure the system clock */
@@ -102,7 +103,8 @@ int main(void)
     MX_TIM3_Init();
     MX_ADC1_Init();
     /* USER CODE BEGIN 2 */
-
+    // 时间戳服务按系统时钟换算DWT计数并依赖RTC秒中断对齐，须在时钟配置和RTC初始化之后启动
+    if (RTC_Init() == HAL_OK) { timestamp_init(); }
     /* USER CODE END 2 */
 
     /* Init scheduler */
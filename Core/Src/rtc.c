@@ -4,15 +4,80 @@
 // 备份寄存器相关定义
 #define BKP_INIT_REG   RTC_BKP_DR1 // 使用备份寄存器1
 #define BKP_INIT_MAGIC 0x1234      // 初始化标记
+#define BKP_PRL_REG    RTC_BKP_DR2 // 当前预分频值(PRL为只写寄存器，需另行保存)
+
+// 标称预分频值(PRL = 频率 - 1)
+#define RTC_PRL_LSE 0x7FFF // 32768Hz
+#define RTC_PRL_LSI 0x9C3F // 约40000Hz
+
+// 振荡器漂移估计参数
+#define RTC_TRIM_MIN_WINDOW_S  3600        // 至少累计1小时的同步间隔才修正
+#define RTC_TRIM_MIN_ERROR_S   2           // 且累计误差不少于2秒(秒级量化下保证估计精度)
+#define RTC_TRIM_MAX_WINDOW_S  (1UL << 24) // 窗口上限，保证64位定点运算不溢出
+#define RTC_TRIM_MAX_DEVIATION 4           // 误差超过间隔的1/4视为用户改时间而非漂移
+#define RTC_CAL_SHIFT          20          // BKP_RTCCR.CAL: 每2^20个时钟脉冲剔除CAL个
+
+// 2000-01-01 00:00:00的UTC时间戳
+#define RTC_UTC_OFFSET_2000           946684800UL
+// 0000-03-01(推算公历)到2000-01-01的天数
+#define DAYS_0000_03_01_TO_2000_01_01 730425UL
+
+// 秒中断优先级(数值不小于configMAX_SYSCALL_INTERRUPT_PRIORITY，回调中可调用FromISR接口)
+#define RTC_IRQ_PRIORITY    5
+#define RTC_MAX_SUBSCRIBERS 4
+
+// 各类等待的超时时间(ms)，RTC时钟缺失时不会无限等待
+#define RTC_LSE_TIMEOUT_MS  5000 // LSE起振较慢，手册典型值约1s
+#define RTC_LSI_TIMEOUT_MS  10
+#define RTC_SYNC_TIMEOUT_MS 100  // RSF/RTOFF等待，正常只需数个RTCCLK周期
 
 // RTC句柄定义
 RTC_HandleTypeDef hrtc;
 
+// 由秒中断增量维护的日期时间缓存，seq为奇数表示正在更新
+static volatile uint32_t            rtc_cache_seq = 0;
+static volatile uint32_t            rtc_cache_counter = 0;
+static volatile RTC_DateTimeTypeDef rtc_cache;
+
+// 时间边沿订阅者
+typedef struct
+{
+    RTC_TickEdge     edge;
+    RTC_TickCallback callback;
+} RTC_Subscriber;
+
+static RTC_Subscriber rtc_subscribers[RTC_MAX_SUBSCRIBERS];
+static uint8_t        rtc_subscriber_count = 0;
+
+// 异步计数器写入状态机
+static volatile RTC_WriteState rtc_write_state = RTC_WRITE_IDLE;
+static volatile bool           rtc_write_pending = false;
+static volatile uint32_t       rtc_write_counter = 0;
+static volatile bool           rtc_prl_pending = false;
+static volatile uint32_t       rtc_prl_value = 0;
+
+// UTC同步记录：自上次修正以来的累计同步间隔与本地时钟误差
+static struct
+{
+    bool     valid;         // 是否已有参考同步点
+    uint32_t last_sync_utc; // 上一次同步的参考UTC
+    uint32_t window_s;      // 累计同步间隔(秒)
+    int32_t  error_s;       // 累计本地误差(秒，正值表示本地偏快)
+} rtc_sync;
+
 // 内部函数声明
 static bool     is_leap_year(uint16_t year);
 static uint8_t  get_days_in_month(uint8_t month, uint16_t year);
+static uint32_t days_from_civil(uint16_t year, uint8_t month, uint8_t day);
+static void     civil_from_days(uint32_t days, uint16_t *year, uint8_t *month, uint8_t *day);
 static uint32_t rtc_get_counter(void);
 static void     rtc_set_counter(uint32_t counter);
+static void     rtc_cache_reload(uint32_t counter);
+static void     rtc_second_irq_enable(void);
+static bool     rtc_wait_flag(volatile uint32_t *reg, uint32_t mask, uint32_t timeout_ms);
+static void     rtc_write_service(void);
+static uint32_t rtc_get_prescaler(void);
+static void     rtc_trim_apply(uint32_t window_s, int32_t error_s);
 
 // 每月天数表(非闰年)
 static const uint8_t days_in_month[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
@@ -37,19 +102,17 @@ HAL_StatusTypeDef RTC_Init(void)
         __HAL_RCC_LSE_CONFIG(RCC_LSE_ON);
 
         // 等待LSE稳定
-        uint32_t timeout = 0xFFFF;
-        while (__HAL_RCC_GET_FLAG(RCC_FLAG_LSERDY) == RESET && timeout-- > 0)
-            ;
-
-        if (timeout == 0)
+        if (rtc_wait_flag(&RCC->BDCR, RCC_BDCR_LSERDY, RTC_LSE_TIMEOUT_MS))
         {
-            // LSE启动失败，尝试使用LSI
+            // 选择RTC时钟源为LSE
+            MODIFY_REG(RCC->BDCR, RCC_BDCR_RTCSEL, RCC_BDCR_RTCSEL_LSE);
+        }
+        else
+        {
+            // LSE启动失败，关闭LSE并尝试使用LSI
+            __HAL_RCC_LSE_CONFIG(RCC_LSE_OFF);
             __HAL_RCC_LSI_ENABLE();
-            timeout = 0xFFFF;
-            while (__HAL_RCC_GET_FLAG(RCC_FLAG_LSIRDY) == RESET && timeout-- > 0)
-                ;
-
-            if (timeout == 0)
+            if (!rtc_wait_flag(&RCC->CSR, RCC_CSR_LSIRDY, RTC_LSI_TIMEOUT_MS))
             {
                 // LSI也启动失败，返回错误
                 return HAL_ERROR;
@@ -58,55 +121,55 @@ HAL_StatusTypeDef RTC_Init(void)
             // 选择RTC时钟源为LSI
             MODIFY_REG(RCC->BDCR, RCC_BDCR_RTCSEL, RCC_BDCR_RTCSEL_LSI);
         }
-        else
-        {
-            // 选择RTC时钟源为LSE
-            MODIFY_REG(RCC->BDCR, RCC_BDCR_RTCSEL, RCC_BDCR_RTCSEL_LSE);
-        }
 
         // 使能RTC时钟
         SET_BIT(RCC->BDCR, RCC_BDCR_RTCEN);
 
-        // 等待RTC寄存器同步
+        // 等待RTC寄存器同步及上一次写操作完成
         CLEAR_BIT(RTC->CRL, RTC_CRL_RSF);
-        while ((RTC->CRL & RTC_CRL_RSF) == 0)
-            ;
+        if (!rtc_wait_flag(&RTC->CRL, RTC_CRL_RSF, RTC_SYNC_TIMEOUT_MS)) return HAL_TIMEOUT;
+        if (!rtc_wait_flag(&RTC->CRL, RTC_CRL_RTOFF, RTC_SYNC_TIMEOUT_MS)) return HAL_TIMEOUT;
 
         // 进入配置模式
         SET_BIT(RTC->CRL, RTC_CRL_CNF);
 
         // 设置预分频器
+        uint32_t prl;
         if (__HAL_RCC_GET_FLAG(RCC_FLAG_LSERDY))
         {
             // LSE为32768Hz，设置预分频得到1Hz
-            RTC->PRLH = 0x0000;
-            RTC->PRLL = 0x7FFF; // 32767
+            prl = RTC_PRL_LSE;
         }
         else
         {
             // LSI约为40000Hz，设置预分频得到1Hz
-            RTC->PRLH = 0x0000;
-            RTC->PRLL = 0x9C3F; // 39999
+            prl = RTC_PRL_LSI;
         }
+        RTC->PRLH = 0x0000;
+        RTC->PRLL = prl;
 
         // 退出配置模式
         CLEAR_BIT(RTC->CRL, RTC_CRL_CNF);
 
         // 等待操作完成
-        while ((RTC->CRL & RTC_CRL_RTOFF) == 0)
-            ;
+        if (!rtc_wait_flag(&RTC->CRL, RTC_CRL_RTOFF, RTC_SYNC_TIMEOUT_MS)) return HAL_TIMEOUT;
 
-        // 标记RTC已初始化(使用HAL的备份寄存器函数)
+        // 记录预分频值并清除校准值，标记RTC已初始化(使用HAL的备份寄存器函数)
+        HAL_RTCEx_BKUPWrite(&hrtc, BKP_PRL_REG, prl);
+        CLEAR_BIT(BKP->RTCCR, BKP_RTCCR_CAL);
         HAL_RTCEx_BKUPWrite(&hrtc, BKP_INIT_REG, BKP_INIT_MAGIC);
     }
     else
     {
         // RTC已初始化，等待寄存器同步
         CLEAR_BIT(RTC->CRL, RTC_CRL_RSF);
-        while ((RTC->CRL & RTC_CRL_RSF) == 0)
-            ;
+        if (!rtc_wait_flag(&RTC->CRL, RTC_CRL_RSF, RTC_SYNC_TIMEOUT_MS)) return HAL_TIMEOUT;
     }
 
+    // 装载日期时间缓存并开启秒中断，此后由中断增量维护
+    rtc_cache_reload(RTC_GetUTC() - RTC_UTC_OFFSET_2000);
+    rtc_second_irq_enable();
+
     return HAL_OK;
 }
 
@@ -128,18 +191,100 @@ HAL_StatusTypeDef RTC_SetDateTime(RTC_DateTimeTypeDef *datetime)
     return RTC_SetUTC(utc);
 }
 
-// 获取当前日期时间(完全自定义实现)
+// 获取当前日期时间(读取秒中断维护的缓存，无需访问RTC寄存器和重算日历)
+// 缓存从未装载(RTC_Init未调用或失败，秒中断未开启)时按计数器现算，不返回全零的日期
 HAL_StatusTypeDef RTC_GetDateTime(RTC_DateTimeTypeDef *datetime)
 {
     if (datetime == NULL) return HAL_ERROR;
+    if (rtc_cache_seq == 0) rtc_cache_reload(rtc_get_counter());
+
+    uint32_t seq;
+    do
+    {
+        // 写入方只有秒中断(或关中断的任务)，读到奇数说明被打断在更新中途
+        while ((seq = rtc_cache_seq) & 1U)
+            ;
+        __DMB();
+        *datetime = *(const RTC_DateTimeTypeDef *) &rtc_cache;
+        __DMB();
+    } while (seq != rtc_cache_seq);
 
-    // 获取当前UTC时间戳并转换为日期时间
-    uint32_t utc = RTC_GetUTC();
-    RTC_UTCToDateTime(utc, datetime);
+    return HAL_OK;
+}
+
+// 注册时间边沿回调(在秒中断中调用，回调内只能使用FromISR类接口)
+HAL_StatusTypeDef RTC_RegisterTickCallback(RTC_TickEdge edge, RTC_TickCallback callback)
+{
+    if (callback == NULL || rtc_subscriber_count >= RTC_MAX_SUBSCRIBERS) return HAL_ERROR;
+
+    NVIC_DisableIRQ(RTC_IRQn);
+    rtc_subscribers[rtc_subscriber_count].edge = edge;
+    rtc_subscribers[rtc_subscriber_count].callback = callback;
+    rtc_subscriber_count++;
+    NVIC_EnableIRQ(RTC_IRQn);
 
     return HAL_OK;
 }
 
+// RTC秒中断处理：增量推进缓存(秒->分->时->日)并分发边沿事件
+void RTC_SecondIRQHandler(void)
+{
+    if ((RTC->CRL & RTC_CRL_SECF) == 0) return;
+    CLEAR_BIT(RTC->CRL, RTC_CRL_SECF);
+
+    // 顺带完成挂起的计数器写入
+    rtc_write_service();
+
+    uint32_t     counter = rtc_get_counter();
+    RTC_TickEdge edge = RTC_EDGE_SECOND;
+
+    // 写入进行中时硬件计数器可能仍是旧值，此时只做增量推进
+    if (RTC_GetWriteState() == RTC_WRITE_IDLE && counter != rtc_cache_counter + 1)
+    {
+        // 计数器被改写或漏掉了中断，整体重算
+        rtc_cache_reload(counter);
+        edge = RTC_EDGE_DAY;
+    }
+    else
+    {
+        rtc_cache_seq++;
+        rtc_cache_counter++;
+        if (++rtc_cache.second >= 60)
+        {
+            rtc_cache.second = 0;
+            edge = RTC_EDGE_MINUTE;
+            if (++rtc_cache.minute >= 60)
+            {
+                rtc_cache.minute = 0;
+                edge = RTC_EDGE_HOUR;
+                if (++rtc_cache.hour >= 24)
+                {
+                    rtc_cache.hour = 0;
+                    edge = RTC_EDGE_DAY;
+                    rtc_cache.weekday = (rtc_cache.weekday + 1) % 7;
+                    if (++rtc_cache.day > get_days_in_month(rtc_cache.month, 2000 + rtc_cache.year))
+                    {
+                        rtc_cache.day = 1;
+                        if (++rtc_cache.month > 12)
+                        {
+                            rtc_cache.month = 1;
+                            rtc_cache.year++;
+                        }
+                    }
+                }
+            }
+        }
+        rtc_cache_seq++;
+    }
+
+    // 边沿逐级包含：跨日同时也是整点、整分和整秒
+    RTC_DateTimeTypeDef now = *(const RTC_DateTimeTypeDef *) &rtc_cache;
+    for (uint8_t i = 0; i < rtc_subscriber_count; i++)
+    {
+        if (rtc_subscribers[i].edge <= edge) rtc_subscribers[i].callback(&now);
+    }
+}
+
 // 获取当前UTC时间戳
 uint32_t RTC_GetUTC(void)
 {
@@ -152,109 +297,192 @@ uint32_t RTC_GetUTC(void)
         counter2 = rtc_get_counter();
     } while (counter1 != counter2);
 
-    return counter1 + 946684800; // 加上2000年到1970年的秒数差
+    return counter1 + RTC_UTC_OFFSET_2000; // 加上2000年到1970年的秒数差
 }
 
-// 设置UTC时间戳
-HAL_StatusTypeDef RTC_SetUTC(uint32_t utc)
+// 获取UTC时间戳及秒内已过去的微秒数(由预分频余数寄存器DIV换算，分辨率约30us)
+uint32_t RTC_GetUTCSubSecond(uint32_t *sub_us)
 {
-    // 转换为2000年为基准的计数器值
-    uint32_t counter = utc - 946684800; // 946684800是2000-01-01 00:00:00的UTC时间戳
+    uint32_t counter, div;
 
-    // 进入配置模式
-    SET_BIT(RTC->CRL, RTC_CRL_CNF);
+    // CNT与DIV需在同一秒内读取
+    do
+    {
+        counter = rtc_get_counter();
+        div = ((RTC->DIVH & RTC_DIVH_RTC_DIV) << 16) | RTC->DIVL;
+    } while (counter != rtc_get_counter());
 
-    // 等待配置模式进入
-    while ((RTC->CRL & RTC_CRL_CNF) == 0)
-        ;
+    if (sub_us != NULL)
+    {
+        // DIV从PRL递减到0后计数器加1
+        uint32_t prl = rtc_get_prescaler();
+        *sub_us = (div <= prl) ? (uint32_t) ((uint64_t) (prl - div) * 1000000U / (prl + 1)) : 0;
+    }
 
-    // 设置计数器值
-    rtc_set_counter(counter);
+    return counter + RTC_UTC_OFFSET_2000;
+}
 
-    // 退出配置模式
-    CLEAR_BIT(RTC->CRL, RTC_CRL_CNF);
+// 设置UTC时间戳(阻塞版本，最多等待RTC_SYNC_TIMEOUT_MS)
+HAL_StatusTypeDef RTC_SetUTC(uint32_t utc)
+{
+    RTC_SetUTCAsync(utc);
 
-    // 等待操作完成
-    while ((RTC->CRL & RTC_CRL_RTOFF) == 0)
-        ;
+    uint32_t tickstart = HAL_GetTick();
+    while (RTC_GetWriteState() != RTC_WRITE_IDLE)
+    {
+        if ((HAL_GetTick() - tickstart) > RTC_SYNC_TIMEOUT_MS) return HAL_TIMEOUT;
+        rtc_write_service();
+    }
 
     return HAL_OK;
 }
 
-// 从UTC时间戳转换为日期时间(完全自定义算法)
-void RTC_UTCToDateTime(uint32_t utc, RTC_DateTimeTypeDef *datetime)
+// 异步设置UTC时间戳：仅登记新计数器值并尝试推进一次状态机，立即返回
+// 若上一次写操作未完成，则由RTC秒中断或RTC_WriteService()(Modbus任务轮询)在RTOFF置位后完成
+HAL_StatusTypeDef RTC_SetUTCAsync(uint32_t utc)
 {
-    if (datetime == NULL) return;
+    // 转换为2000年为基准的计数器值
+    uint32_t counter = utc - RTC_UTC_OFFSET_2000;
 
-    // 转换为2000年为基准的秒数
-    uint32_t seconds = utc - 946684800; // 946684800是2000-01-01 00:00:00的UTC时间戳
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    rtc_write_counter = counter; // 多次写入只保留最新值
+    rtc_write_pending = true;
+    __set_PRIMASK(primask);
 
-    datetime->second = seconds % 60;
-    seconds /= 60;
+    // 新时间立即对读取方可见
+    rtc_cache_reload(counter);
+    rtc_write_service();
 
-    datetime->minute = seconds % 60;
-    seconds /= 60;
+    return HAL_OK;
+}
 
-    datetime->hour = seconds % 24;
-    uint32_t days = seconds / 24;
+// 外部UTC同步：记录参考时间与本地时间的偏差，累计足够后自动修正振荡器频率
+// 本地时间与参考一致时不改写计数器，保留秒内相位以便误差继续累计
+HAL_StatusTypeDef RTC_SyncUTC(uint32_t utc)
+{
+    int32_t error_s = (int32_t) (RTC_GetUTC() - utc);
 
-    // 计算年份(2000年开始)
-    datetime->year = 0;
-    while (1)
+    if (rtc_sync.valid && utc > rtc_sync.last_sync_utc)
     {
-        uint16_t year = 2000 + datetime->year;
-        uint32_t days_in_year = is_leap_year(year) ? 366 : 365;
+        uint32_t interval = utc - rtc_sync.last_sync_utc;
+        uint32_t abs_error = (error_s < 0) ? (uint32_t) -error_s : (uint32_t) error_s;
 
-        if (days < days_in_year) break;
+        if (interval > RTC_TRIM_MAX_WINDOW_S || abs_error > interval / RTC_TRIM_MAX_DEVIATION + 1)
+        {
+            // 偏差过大或间隔过长，视为时间跳变，重新开始统计
+            rtc_sync.window_s = 0;
+            rtc_sync.error_s = 0;
+        }
+        else
+        {
+            rtc_sync.window_s += interval;
+            rtc_sync.error_s += error_s;
 
-        days -= days_in_year;
-        datetime->year++;
+            int32_t abs_sum = (rtc_sync.error_s < 0) ? -rtc_sync.error_s : rtc_sync.error_s;
+            if (rtc_sync.window_s >= RTC_TRIM_MIN_WINDOW_S && abs_sum >= RTC_TRIM_MIN_ERROR_S)
+            {
+                rtc_trim_apply(rtc_sync.window_s, rtc_sync.error_s);
+                rtc_sync.window_s = 0;
+                rtc_sync.error_s = 0;
+            }
+            else if (rtc_sync.window_s >= RTC_TRIM_MAX_WINDOW_S)
+            {
+                // 长期无明显误差，频率已足够准确
+                rtc_sync.window_s = 0;
+                rtc_sync.error_s = 0;
+            }
+        }
     }
-
-    // 计算月份和日期
-    datetime->month = 1;
-    while (1)
+    else
     {
-        uint16_t year = 2000 + datetime->year;
-        uint8_t  dim = get_days_in_month(datetime->month, year);
+        rtc_sync.window_s = 0;
+        rtc_sync.error_s = 0;
+    }
+    rtc_sync.valid = true;
+    rtc_sync.last_sync_utc = utc;
 
-        if (days < dim) break;
+    if (error_s == 0) return HAL_OK;
+    return RTC_SetUTCAsync(utc);
+}
 
-        days -= dim;
-        datetime->month++;
-    }
+// 查询异步写入状态
+RTC_WriteState RTC_GetWriteState(void)
+{
+    return (rtc_write_pending || rtc_prl_pending) ? RTC_WRITE_PENDING : rtc_write_state;
+}
+
+// 推进异步写入状态机(不会阻塞；Modbus任务在写入未完成期间轮询调用，不依赖秒中断)
+void RTC_WriteService(void)
+{
+    rtc_write_service();
+}
+
+// 从UTC时间戳转换为日期时间(闭式civil-from-days算法，耗时与日期无关)
+void RTC_UTCToDateTime(uint32_t utc, RTC_DateTimeTypeDef *datetime)
+{
+    if (datetime == NULL) return;
+
+    // 转换为2000年为基准的秒数
+    uint32_t seconds = utc - RTC_UTC_OFFSET_2000;
+    uint32_t days = seconds / 86400;
+    uint32_t sod = seconds - days * 86400; // 当日秒数
+
+    datetime->hour = sod / 3600;
+    sod -= datetime->hour * 3600;
+    datetime->minute = sod / 60;
+    datetime->second = sod - datetime->minute * 60;
+
+    uint16_t year;
+    uint8_t  month, day;
+    civil_from_days(days, &year, &month, &day);
 
-    datetime->day = days + 1; // 天数从1开始
+    datetime->year = year - 2000;
+    datetime->month = month;
+    datetime->day = day;
 
     // 计算星期几 (2000-01-01是星期六)
     datetime->weekday = (days + 6) % 7; // 0=星期日, 6=星期六
 }
 
-// 从日期时间转换为UTC时间戳(完全自定义算法)
+// 从日期时间转换为UTC时间戳(闭式days-from-civil算法，耗时与日期无关)
 uint32_t RTC_DateTimeToUTC(RTC_DateTimeTypeDef *datetime)
 {
     if (datetime == NULL) return 0;
 
-    uint32_t seconds = 0;
+    uint32_t days = days_from_civil(2000 + datetime->year, datetime->month, datetime->day);
+    uint32_t seconds = days * 86400 + datetime->hour * 3600 + datetime->minute * 60 + datetime->second;
 
-    // 计算从2000年到指定年份的总天数
-    for (uint8_t y = 0; y < datetime->year; y++)
-    {
-        seconds += is_leap_year(2000 + y) ? 366 : 365;
-    }
-
-    // 计算从年初到指定月份的总天数
-    for (uint8_t m = 1; m < datetime->month; m++)
-    {
-        seconds += get_days_in_month(m, 2000 + datetime->year);
-    }
+    // 加上2000年到1970年的秒数差
+    return seconds + RTC_UTC_OFFSET_2000;
+}
 
-    // 加上日期、小时、分钟和秒
-    seconds += (datetime->day - 1);
-    seconds = seconds * 86400 + datetime->hour * 3600 + datetime->minute * 60 + datetime->second;
+// 内部函数：公历日期转换为自2000-01-01起的天数
+// 以3月1日为年首，闰日落在年末，400年一个周期(146097天)，全程无循环
+static uint32_t days_from_civil(uint16_t year, uint8_t month, uint8_t day)
+{
+    uint32_t y = year - (month <= 2);
+    uint32_t era = y / 400;
+    uint32_t yoe = y - era * 400;                          // [0, 399]
+    uint32_t mp = (month > 2) ? (month - 3) : (month + 9); // 3月=0 ... 2月=11
+    uint32_t doy = (153 * mp + 2) / 5 + day - 1;           // [0, 365]
+    uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;  // [0, 146096]
+    return era * 146097 + doe - DAYS_0000_03_01_TO_2000_01_01;
+}
 
-    // 加上2000年到1970年的秒数差
-    return seconds + 946684800;
+// 内部函数：自2000-01-01起的天数转换为公历日期(days_from_civil的逆运算)
+static void civil_from_days(uint32_t days, uint16_t *year, uint8_t *month, uint8_t *day)
+{
+    uint32_t z = days + DAYS_0000_03_01_TO_2000_01_01;
+    uint32_t era = z / 146097;
+    uint32_t doe = z - era * 146097;                                      // [0, 146096]
+    uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; // [0, 399]
+    uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);               // [0, 365]
+    uint32_t mp = (5 * doy + 2) / 153;                                    // [0, 11]
+
+    *day = doy - (153 * mp + 2) / 5 + 1;
+    *month = (mp < 10) ? (mp + 3) : (mp - 9);
+    *year = yoe + era * 400 + (*month <= 2);
 }
 
 // 内部函数：判断是否为闰年
@@ -288,3 +516,114 @@ static void rtc_set_counter(uint32_t counter)
     RTC->CNTH = (counter >> 16) & 0xFFFF;
     RTC->CNTL = counter & 0xFFFF;
 }
+
+// 内部函数：按计数器值整体重算日期时间缓存(可在任务或中断中调用)
+static void rtc_cache_reload(uint32_t counter)
+{
+    RTC_DateTimeTypeDef datetime;
+    RTC_UTCToDateTime(counter + RTC_UTC_OFFSET_2000, &datetime);
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    rtc_cache_seq++;
+    rtc_cache_counter = counter;
+    rtc_cache = datetime;
+    rtc_cache_seq++;
+    __set_PRIMASK(primask);
+}
+
+// 内部函数：开启RTC秒中断
+static void rtc_second_irq_enable(void)
+{
+    // CRH写入不需要进入配置模式，但需等待上一次写操作完成
+    if (!rtc_wait_flag(&RTC->CRL, RTC_CRL_RTOFF, RTC_SYNC_TIMEOUT_MS)) return;
+    CLEAR_BIT(RTC->CRL, RTC_CRL_SECF);
+    SET_BIT(RTC->CRH, RTC_CRH_SECIE);
+
+    HAL_NVIC_SetPriority(RTC_IRQn, RTC_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(RTC_IRQn);
+}
+
+// 内部函数：在超时时间内等待寄存器标志置位
+static bool rtc_wait_flag(volatile uint32_t *reg, uint32_t mask, uint32_t timeout_ms)
+{
+    uint32_t tickstart = HAL_GetTick();
+    while ((*reg & mask) == 0)
+    {
+        if ((HAL_GetTick() - tickstart) > timeout_ms) return false;
+    }
+    return true;
+}
+
+// 内部函数：异步写入状态机，每次调用只检查RTOFF一次，从不等待
+// IDLE/BUSY --(RTOFF=1且有挂起值)--> 写CNTH/CNTL --> BUSY --(RTOFF=1)--> IDLE
+static void rtc_write_service(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if ((RTC->CRL & RTC_CRL_RTOFF) != 0)
+    {
+        if (rtc_write_pending || rtc_prl_pending)
+        {
+            SET_BIT(RTC->CRL, RTC_CRL_CNF);
+            if (rtc_write_pending) rtc_set_counter(rtc_write_counter);
+            if (rtc_prl_pending)
+            {
+                RTC->PRLH = (rtc_prl_value >> 16) & 0x000F;
+                RTC->PRLL = rtc_prl_value & 0xFFFF;
+            }
+            CLEAR_BIT(RTC->CRL, RTC_CRL_CNF);
+            rtc_write_pending = false;
+            rtc_prl_pending = false;
+            rtc_write_state = RTC_WRITE_BUSY;
+        }
+        else
+        {
+            rtc_write_state = RTC_WRITE_IDLE;
+        }
+    }
+
+    __set_PRIMASK(primask);
+}
+
+// 内部函数：读取当前预分频值(兼容未记录预分频值的旧版本初始化)
+static uint32_t rtc_get_prescaler(void)
+{
+    uint32_t prl = HAL_RTCEx_BKUPRead(&hrtc, BKP_PRL_REG);
+    if (prl != 0) return prl;
+
+    return (READ_BIT(RCC->BDCR, RCC_BDCR_RTCSEL) == RCC_BDCR_RTCSEL_LSE) ? RTC_PRL_LSE : RTC_PRL_LSI;
+}
+
+// 内部函数：根据累计误差修正振荡器频率
+// 在window_s秒内本地多走了error_s秒，则实际有效频率 f = (PRL+1)*(window+error)/window；
+// 扣除当前校准值的影响得到原始频率后，PRL取其整数部分(使时钟略快)，
+// 剩余小数部分由BKP_RTCCR.CAL(每2^20个脉冲剔除CAL个，约0.95ppm/步)补偿
+static void rtc_trim_apply(uint32_t window_s, int32_t error_s)
+{
+    uint32_t prl = rtc_get_prescaler();
+    uint32_t cal = READ_BIT(BKP->RTCCR, BKP_RTCCR_CAL);
+
+    // 有效频率与原始频率(Q20定点，单位Hz)
+    uint64_t f_eff = ((uint64_t) (prl + 1) * (uint64_t) ((int64_t) window_s + error_s) << RTC_CAL_SHIFT) / window_s;
+    uint64_t f_raw = (f_eff << RTC_CAL_SHIFT) / ((1UL << RTC_CAL_SHIFT) - cal);
+
+    uint32_t period = (uint32_t) (f_raw >> RTC_CAL_SHIFT);
+    if (period < 2 || period > 0x10000) return; // 超出PRL及备份寄存器范围，估计不可信
+
+    uint64_t residual = f_raw - ((uint64_t) period << RTC_CAL_SHIFT);
+    uint32_t new_cal = (uint32_t) (((residual << RTC_CAL_SHIFT) + f_raw / 2) / f_raw);
+    if (new_cal > BKP_RTCCR_CAL) new_cal = BKP_RTCCR_CAL;
+
+    // 预分频值经异步写入状态机生效，校准值直接写入备份域
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    rtc_prl_value = period - 1;
+    rtc_prl_pending = true;
+    __set_PRIMASK(primask);
+    rtc_write_service();
+
+    MODIFY_REG(BKP->RTCCR, BKP_RTCCR_CAL, new_cal);
+    HAL_RTCEx_BKUPWrite(&hrtc, BKP_PRL_REG, period - 1);
+}
@@ -6,6 +6,17 @@
 // 全局闹钟管理器实例
 static AlarmManager alarm_manager;
 
+// 闹钟检查任务句柄（供RTC分钟边沿回调唤醒）
+static TaskHandle_t alarm_task_handle = NULL;
+
+// 闹钟触发回调（默认为空，宿主机仿真可挂接以记录每次触发）
+static AlarmFireHook alarm_fire_hook = NULL;
+
+void alarm_set_fire_hook(AlarmFireHook hook)
+{
+    alarm_fire_hook = hook;
+}
+
 // 初始化闹钟管理器
 void alarm_manager_init(AlarmManager *manager)
 {
@@ -106,6 +117,8 @@ bool alarm_is_triggered(Alarm *alarm, uint8_t current_hour, uint8_t current_minu
 // 闹钟触发时的动作处理（可根据需要扩展）
 static void alarm_execute_action(Alarm *alarm)
 {
+    if (alarm_fire_hook != NULL) alarm_fire_hook(alarm);
+
     // 示例：触发加热功能
     heat_set_status(HEAT_RUNNING);
 
@@ -122,7 +135,42 @@ static void alarm_execute_action(Alarm *alarm)
     // 可添加其他动作：如播放铃声（根据alarm->ringtone_id）
 }
 
-// 闹钟检查任务
+// 按给定时刻评估所有闹钟并执行触发动作（与时间来源无关，便于虚拟时钟下回放）
+uint8_t alarm_evaluate(AlarmManager *manager, const RTC_DateTimeTypeDef *now)
+{
+    if (manager == NULL || now == NULL) return 0;
+
+    uint8_t fired = 0;
+
+    // 加锁检查所有闹钟
+    if (xSemaphoreTake(manager->mutex, portMAX_DELAY) != pdTRUE) return 0;
+
+    for (uint8_t i = 0; i < 32; i++)
+    {
+        Alarm *alarm = &manager->alarms[i];
+        if (alarm_is_triggered(alarm, now->hour, now->minute, now->weekday))
+        {
+            alarm_execute_action(alarm);
+            fired++;
+        }
+    }
+    xSemaphoreGive(manager->mutex);
+
+    return fired;
+}
+
+// RTC分钟边沿回调（秒中断上下文）：唤醒闹钟检查任务
+static void alarm_minute_tick(const RTC_DateTimeTypeDef *now)
+{
+    (void) now;
+    if (alarm_task_handle == NULL) return;
+
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(alarm_task_handle, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+// 闹钟检查任务：在每分钟边沿被唤醒，超时轮询作为RTC中断缺失时的兜底
 void alarm_check_task(void *params)
 {
     (void) params;
@@ -131,31 +179,17 @@ void alarm_check_task(void *params)
 
     for (;;)
     {
-        // 获取当前时间
+        // 获取当前时间（读取秒中断维护的缓存）
         RTC_GetDateTime(&current_time);
 
         // 每分钟检查一次（仅当分钟变化时）
         if (current_time.minute != last_minute)
         {
             last_minute = current_time.minute;
-
-            // 加锁检查所有闹钟
-            if (xSemaphoreTake(alarm_manager.mutex, portMAX_DELAY) == pdTRUE)
-            {
-                for (uint8_t i = 0; i < 32; i++)
-                {
-                    Alarm *alarm = &alarm_manager.alarms[i];
-                    if (alarm_is_triggered(alarm, current_time.hour, current_time.minute, current_time.weekday))
-                    {
-                        alarm_execute_action(alarm);
-                    }
-                }
-                xSemaphoreGive(alarm_manager.mutex);
-            }
+            alarm_evaluate(&alarm_manager, &current_time);
         }
 
-        // 10秒检查一次时间（平衡精度和资源占用）
-        vTaskDelay(pdMS_TO_TICKS(10000));
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ALARM_CHECK_INTERVAL_MS));
     }
 }
 
@@ -169,7 +203,10 @@ void alarm_system_init(void)
                 256, // 堆栈大小
                 NULL,
                 2, // 任务优先级
-                NULL);
+                &alarm_task_handle);
+
+    // 订阅RTC分钟边沿，闹钟在整分时刻被评估
+    RTC_RegisterTickCallback(RTC_EDGE_MINUTE, alarm_minute_tick);
 }
 
 // 供Modbus处理函数调用的接口
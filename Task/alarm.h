@@ -7,6 +7,10 @@
 #include <stdint.h>
 
 #include "protocal_task.h"
+#include "rtc.h"
+
+// 闹钟任务兜底轮询RTC的间隔（毫秒），正常由RTC分钟边沿唤醒
+#define ALARM_CHECK_INTERVAL_MS 10000
 // 闹钟状态枚举（平台无关）
 typedef enum
 {
@@ -56,12 +60,18 @@ typedef struct
     SemaphoreHandle_t mutex;      // 保护闹钟数据的互斥锁
 } AlarmManager;
 
+// 闹钟触发回调类型（在执行动作前调用，持有管理器锁）
+typedef void (*AlarmFireHook)(const Alarm *alarm);
+
 // 外部接口声明
+void        alarm_system_init(void);
 void        alarm_manager_init(AlarmManager *manager);
 AlarmResult alarm_parse_and_save(AlarmManager *manager, uint16_t high_reg, uint16_t low_reg);
 AlarmResult alarm_delete(AlarmManager *manager, uint8_t alarm_id);
 void        alarm_check_task(void *params);
 bool        alarm_is_triggered(Alarm *alarm, uint8_t current_hour, uint8_t current_minute, uint8_t current_weekday);
 AlarmResult alarm_handle_modbus_write(RegisterID reg, uint16_t value);
+uint8_t     alarm_evaluate(AlarmManager *manager, const RTC_DateTimeTypeDef *now);
+void        alarm_set_fire_hook(AlarmFireHook hook);
 
 #endif /* __ALARM_H */
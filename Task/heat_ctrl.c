@@ -0,0 +1,166 @@
+#include "heat_ctrl.h"
+#include <stddef.h>
+
+#define HEAT_SETTLE_BAND     Q16_FROM_FLOAT(0.3f) // 误差在该范围内视为稳定（℃）
+#define HEAT_SETTLE_TIME_MS  5000                 // 持续稳定该时间后切换为慢速周期
+#define HEAT_SENSOR_LAG_S    10.0f                // NTC相对加热片的测量滞后时间常数（秒）
+#define HEAT_MODEL_INT_BAND  Q16_FROM_INT(1)      // 模型有效时的积分启用区间（前馈已提供稳态占空比）
+#define HEAT_TUNE_HYSTERESIS Q16_FROM_FLOAT(0.3f) // 继电回差（℃）
+
+// 各档位目标温度，同时作为增益调度的温度节点
+const q16_t heat_level_temp[HEAT_LEVEL_NUM] = {Q16_FROM_INT(35), Q16_FROM_INT(45), Q16_FROM_INT(55)};
+
+// 未整定时使用的默认增益
+const HeatGains heat_default_gains = {Q16_FROM_FLOAT(10.0f), Q16_FROM_FLOAT(0.1f), Q16_FROM_FLOAT(4.5f)};
+
+// 内部函数：按目标温度选择增益（增益调度），取设定温度最接近目标值的档位
+static const HeatGains *heat_gains_select(const HeatCtrl *c, q16_t target)
+{
+    uint8_t best = 0;
+    q16_t   best_diff = INT32_MAX;
+
+    for (uint8_t i = 0; i < HEAT_LEVEL_NUM; i++)
+    {
+        q16_t diff = target - heat_level_temp[i];
+        if (diff < 0) diff = -diff;
+        if (diff < best_diff)
+        {
+            best_diff = diff;
+            best = i;
+        }
+    }
+    return &c->gains[best];
+}
+
+void heat_ctrl_init(HeatCtrl *c)
+{
+    for (uint8_t i = 0; i < HEAT_LEVEL_NUM; i++) { c->gains[i] = heat_default_gains; }
+    c->applied_gains = NULL;
+
+    // PID输出允许为负，与前馈量相加后再限幅到0~100%
+    PID_Q_Init(&c->pid, heat_default_gains.Kp, heat_default_gains.Ki, heat_default_gains.Kd, Q16_FROM_INT(50),
+               Q16_FROM_INT(-100), Q16_FROM_INT(100));
+    c->default_int_band = c->pid.integral_band;
+    thermal_model_init(&c->model, HEAT_SENSOR_LAG_S);
+
+    c->tuning = 0;
+    c->profile_id = HEAT_PROFILE_NONE;
+    c->profile_start = 0;
+    heat_ctrl_start(c);
+}
+
+void heat_ctrl_start(HeatCtrl *c)
+{
+    PID_Q_Reset(&c->pid);
+    c->period_ms = HEAT_CONTROL_PERIOD_MS;
+    c->settled_ms = 0;
+    c->output = 0;
+    c->at_target = 0;
+    c->model_restart = 1;
+}
+
+void heat_ctrl_retarget(HeatCtrl *c)
+{
+    c->period_ms = HEAT_CONTROL_PERIOD_MS;
+    c->settled_ms = 0;
+}
+
+void heat_ctrl_set_tuning(HeatCtrl *c, uint8_t enable, q16_t target)
+{
+    c->tuning = enable;
+    PID_Q_Reset(&c->pid);
+    heat_ctrl_retarget(c);
+    if (enable) { PID_Tune_Init(&c->tuner, target, HEAT_TUNE_HYSTERESIS, 0, Q16_FROM_INT(100)); }
+}
+
+void heat_ctrl_set_profile(HeatCtrl *c, uint8_t id)
+{
+    c->profile_id = id;
+    c->profile_start = (id != HEAT_PROFILE_NONE);
+    heat_ctrl_retarget(c);
+}
+
+// 反馈量经Smith预估补偿传感器滞后，PID输出叠加模型前馈量；
+// 误差持续处于稳定带内后控制周期由100ms放慢到1s，离开稳定带或曲线斜坡中立即恢复
+HeatCtrlEvent heat_ctrl_step(HeatCtrl *c, const q16_t *temp, q16_t target)
+{
+    c->at_target = 0;
+
+    if (temp == NULL)
+    {
+        PID_Q_Reset(&c->pid);
+        c->output = 0;
+        c->model_restart = 1;
+        if (c->tuning)
+        {
+            c->tuning = 0;
+            return HEAT_CTRL_EVENT_TUNE_FAILED;
+        }
+        return HEAT_CTRL_EVENT_NONE;
+    }
+
+    q16_t current_temp = *temp;
+
+    // 以上一周期的占空比更新模型（整定期间的继电激励同样用于辨识）
+    if (c->model_restart) { thermal_model_restart(&c->model, current_temp); }
+    else { thermal_model_update(&c->model, current_temp, c->output, c->period_ms); }
+    c->model_restart = 0;
+
+    if (c->tuning)
+    {
+        PID_TuneState state;
+        c->output = PID_Tune_Step(&c->tuner, current_temp, c->period_ms, &state);
+        if (state == PID_TUNE_RUNNING) return HEAT_CTRL_EVENT_NONE;
+
+        c->output = 0;
+        c->tuning = 0;
+        c->applied_gains = NULL; // 强制重新选择增益
+        return (state == PID_TUNE_DONE) ? HEAT_CTRL_EVENT_TUNE_DONE : HEAT_CTRL_EVENT_TUNE_FAILED;
+    }
+
+    // 设定值：执行曲线时由曲线逐周期插值，否则为档位目标温度
+    q16_t setpoint = target;
+    if (c->profile_id != HEAT_PROFILE_NONE)
+    {
+        if (c->profile_start)
+        {
+            heat_profile_start(&c->runner, heat_profile_get(c->profile_id), current_temp);
+            c->profile_start = 0;
+        }
+        if (!heat_profile_step(&c->runner, c->period_ms))
+        {
+            c->output = 0;
+            c->profile_id = HEAT_PROFILE_NONE;
+            return HEAT_CTRL_EVENT_PROFILE_END;
+        }
+        setpoint = c->runner.setpoint;
+    }
+
+    // 设定值跨越增益调度节点时切换增益
+    const HeatGains *gains = heat_gains_select(c, setpoint);
+    if (gains != c->applied_gains)
+    {
+        c->pid.Kp = gains->Kp;
+        c->pid.Ki = gains->Ki;
+        c->pid.Kd = gains->Kd;
+        c->applied_gains = gains;
+    }
+
+    // 模型有效时积分仅在设定值附近修正残差，避免升温阶段积分累积造成超调
+    c->pid.integral_band = thermal_model_valid(&c->model) ? HEAT_MODEL_INT_BAND : c->default_int_band;
+    q16_t feedback = thermal_model_compensate(&c->model, current_temp);
+    q16_t feedforward = thermal_model_feedforward(&c->model, setpoint);
+    q16_t pid_output = PID_Q(&c->pid, feedback, setpoint, c->period_ms);
+    c->output = q16_clamp(feedforward + pid_output, 0, Q16_FROM_INT(100));
+
+    q16_t error = setpoint - current_temp;
+    c->at_target = (error > -HEAT_SETTLE_BAND && error < HEAT_SETTLE_BAND);
+    if (c->at_target && !(c->profile_id != HEAT_PROFILE_NONE && heat_profile_ramping(&c->runner)))
+    {
+        if (c->settled_ms < HEAT_SETTLE_TIME_MS) c->settled_ms += c->period_ms;
+    }
+    else { c->settled_ms = 0; }
+    c->period_ms = (c->settled_ms >= HEAT_SETTLE_TIME_MS) ? HEAT_CONTROL_SLOW_MS : HEAT_CONTROL_PERIOD_MS;
+
+    return HEAT_CTRL_EVENT_NONE;
+}
@@ -0,0 +1,101 @@
+#ifndef HEAT_CTRL_H
+#define HEAT_CTRL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*----------------------------------include-----------------------------------*/
+#include "fixed.h"
+#include "heat_profile.h"
+#include "heat_task.h"
+#include "pid.h"
+#include "thermal_model.h"
+#include <stdint.h>
+/*-----------------------------------macro------------------------------------*/
+#define HEAT_CONTROL_PERIOD_MS 100  // 升温/调整阶段控制周期（毫秒）
+#define HEAT_CONTROL_SLOW_MS   1000 // 稳定后控制周期（毫秒）
+/*----------------------------------typedef-----------------------------------*/
+// PID增益
+typedef struct
+{
+    q16_t Kp;
+    q16_t Ki;
+    q16_t Kd;
+} HeatGains;
+
+// 单步控制产生的事件（由调用方处理保存增益、停止加热等副作用）
+typedef enum
+{
+    HEAT_CTRL_EVENT_NONE = 0,
+    HEAT_CTRL_EVENT_TUNE_DONE,   // 自整定完成，结果在tuner中
+    HEAT_CTRL_EVENT_TUNE_FAILED, // 自整定失败（超时、未起振或测温失败）
+    HEAT_CTRL_EVENT_PROFILE_END  // 加热曲线执行完毕
+} HeatCtrlEvent;
+
+// 加热控制律状态：PID、自整定、热模型与加热曲线，不依赖RTOS和硬件
+typedef struct
+{
+    PID_Q_Controller  pid;
+    PID_Tuner         tuner;
+    ThermalModel      model;
+    HeatProfileRunner runner;
+    HeatGains         gains[HEAT_LEVEL_NUM]; // 各档位增益（以档位目标温度为调度节点）
+    const HeatGains  *applied_gains;         // 当前使用的增益
+    q16_t             default_int_band;      // 模型无效时的积分启用区间
+    q16_t             output;                // 本周期输出占空比（0~100%）
+    uint16_t          period_ms;             // 当前控制周期
+    uint16_t          settled_ms;            // 误差持续处于稳定带内的时间
+    uint8_t           at_target;             // 本周期误差是否处于稳定带内
+    uint8_t           model_restart;         // 下次控制时以测量值重置模型状态
+    uint8_t           tuning;                // 是否处于自整定
+    uint8_t           profile_id;            // 执行中的曲线编号
+    uint8_t           profile_start;         // 下次控制时从测量温度起步执行曲线
+} HeatCtrl;
+/*----------------------------------variable----------------------------------*/
+extern const q16_t     heat_level_temp[HEAT_LEVEL_NUM]; // 各档位目标温度
+extern const HeatGains heat_default_gains;              // 未整定时使用的默认增益
+/*-------------------------------------os-------------------------------------*/
+
+/*----------------------------------function----------------------------------*/
+/**
+ * @brief 初始化控制律（各档位取默认增益）
+ */
+void heat_ctrl_init(HeatCtrl *c);
+
+/**
+ * @brief 启动加热时复位控制状态（PID、控制周期、输出与模型状态）
+ */
+void heat_ctrl_start(HeatCtrl *c);
+
+/**
+ * @brief 目标温度变化：恢复快速周期
+ */
+void heat_ctrl_retarget(HeatCtrl *c);
+
+/**
+ * @brief 启动/取消自整定
+ * @param target 整定设定值
+ */
+void heat_ctrl_set_tuning(HeatCtrl *c, uint8_t enable, q16_t target);
+
+/**
+ * @brief 切换加热曲线，新曲线在下次控制时从测量温度起步；HEAT_PROFILE_NONE为取消
+ */
+void heat_ctrl_set_profile(HeatCtrl *c, uint8_t id);
+
+/**
+ * @brief 执行一次控制
+ * @param temp 测量温度（Q16.16），NULL表示测温失败（输出关闭）
+ * @param target 档位目标温度（执行曲线时由曲线设定值代替）
+ * @return 本周期产生的事件；输出、下一周期长度与稳定标志分别在output、period_ms、at_target中
+ */
+HeatCtrlEvent heat_ctrl_step(HeatCtrl *c, const q16_t *temp, q16_t target);
+/*------------------------------------test------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEAT_CTRL_H */
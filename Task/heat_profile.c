@@ -0,0 +1,74 @@
+#include "heat_profile.h"
+#include <stddef.h>
+
+// 曲线1：快速舒缓。升温至45℃保持15分钟，再降至38℃保持10分钟
+static const HeatSegment heat_profile_soothe[] = {
+    {15 * 60, Q16_FROM_INT(45), Q16_FROM_FLOAT(0.2f)},
+    {10 * 60, Q16_FROM_INT(38), Q16_FROM_FLOAT(0.02f)},
+};
+
+// 曲线2：渐进深热。缓升至40℃适应，再缓升至50℃保持，最后回落至40℃
+static const HeatSegment heat_profile_deep[] = {
+    {10 * 60, Q16_FROM_INT(40), Q16_FROM_FLOAT(0.05f)},
+    {20 * 60, Q16_FROM_INT(50), Q16_FROM_FLOAT(0.02f)},
+    {10 * 60, Q16_FROM_INT(40), Q16_FROM_FLOAT(0.02f)},
+};
+
+static const HeatProfile heat_profiles[HEAT_PROFILE_NUM] = {
+    {heat_profile_soothe, sizeof(heat_profile_soothe) / sizeof(heat_profile_soothe[0])},
+    {heat_profile_deep, sizeof(heat_profile_deep) / sizeof(heat_profile_deep[0])},
+};
+
+const HeatProfile *heat_profile_get(uint8_t id)
+{
+    if (id == HEAT_PROFILE_NONE || id > HEAT_PROFILE_NUM) return NULL;
+    return &heat_profiles[id - 1];
+}
+
+void heat_profile_start(HeatProfileRunner *runner, const HeatProfile *profile, q16_t start_temp)
+{
+    runner->profile = profile;
+    runner->index = 0;
+    runner->elapsed_ms = 0;
+    runner->setpoint = start_temp;
+    runner->ramp_rem = 0;
+}
+
+uint8_t heat_profile_step(HeatProfileRunner *runner, uint16_t dt_ms)
+{
+    if (runner->profile == NULL || runner->index >= runner->profile->count) return 0;
+
+    const HeatSegment *seg = &runner->profile->segments[runner->index];
+
+    if (seg->ramp_rate == 0) { runner->setpoint = seg->target; }
+    else if (runner->setpoint != seg->target)
+    {
+        // 增量 = 速率·dt，余数带入下一周期，整段斜坡无累计截断误差
+        int64_t num = (int64_t) seg->ramp_rate * dt_ms + runner->ramp_rem;
+        q16_t   delta = (q16_t) (num / 1000);
+        runner->ramp_rem = (int32_t) (num % 1000);
+
+        if (runner->setpoint < seg->target)
+        {
+            runner->setpoint = (seg->target - runner->setpoint > delta) ? runner->setpoint + delta : seg->target;
+        }
+        else { runner->setpoint = (runner->setpoint - seg->target > delta) ? runner->setpoint - delta : seg->target; }
+    }
+
+    // 段时长到达后进入下一段
+    runner->elapsed_ms += dt_ms;
+    if (seg->duration_s != 0 && runner->elapsed_ms >= (uint32_t) seg->duration_s * 1000U)
+    {
+        runner->index++;
+        runner->elapsed_ms = 0;
+        runner->ramp_rem = 0;
+        if (runner->index >= runner->profile->count) return 0;
+    }
+    return 1;
+}
+
+uint8_t heat_profile_ramping(const HeatProfileRunner *runner)
+{
+    if (runner->profile == NULL || runner->index >= runner->profile->count) return 0;
+    return runner->setpoint != runner->profile->segments[runner->index].target;
+}
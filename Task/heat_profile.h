@@ -0,0 +1,73 @@
+#ifndef HEAT_PROFILE_H
+#define HEAT_PROFILE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*----------------------------------include-----------------------------------*/
+#include "fixed.h"
+#include <stdint.h>
+/*-----------------------------------macro------------------------------------*/
+#define HEAT_PROFILE_NONE 0 // 无曲线（按档位恒温）
+#define HEAT_PROFILE_NUM  2 // 内置曲线数量（编号1~HEAT_PROFILE_NUM）
+/*----------------------------------typedef-----------------------------------*/
+// 曲线段：段开始后设定值以ramp_rate逼近target（0为阶跃），自段开始计满duration_s后进入下一段
+typedef struct
+{
+    uint16_t duration_s; // 段时长（秒，含升降温时间；末段为0表示一直保持）
+    q16_t    target;     // 段目标温度（Q16.16，℃）
+    q16_t    ramp_rate;  // 升降温速率（Q16.16，℃/秒，0为阶跃）
+} HeatSegment;
+
+// 加热曲线
+typedef struct
+{
+    const HeatSegment *segments;
+    uint8_t            count;
+} HeatProfile;
+
+// 曲线执行状态
+typedef struct
+{
+    const HeatProfile *profile;
+    uint8_t            index;      // 当前段序号
+    uint32_t           elapsed_ms; // 当前段已执行时间
+    q16_t              setpoint;   // 当前设定值（Q16.16，℃）
+    int32_t            ramp_rem;   // 斜坡增量的除法余数（逐周期累积，避免长斜坡截断误差）
+} HeatProfileRunner;
+/*----------------------------------variable----------------------------------*/
+
+/*-------------------------------------os-------------------------------------*/
+
+/*----------------------------------function----------------------------------*/
+/**
+ * @brief 获取内置曲线
+ * @param id 曲线编号（1~HEAT_PROFILE_NUM）
+ * @return 曲线指针，编号无效时返回NULL
+ */
+const HeatProfile *heat_profile_get(uint8_t id);
+
+/**
+ * @brief 从指定起始温度开始执行曲线（首段斜坡从起始温度出发）
+ */
+void heat_profile_start(HeatProfileRunner *runner, const HeatProfile *profile, q16_t start_temp);
+
+/**
+ * @brief 推进一个控制周期，更新runner->setpoint
+ * @return 1: 曲线执行中；0: 曲线已结束
+ */
+uint8_t heat_profile_step(HeatProfileRunner *runner, uint16_t dt_ms);
+
+/**
+ * @brief 设定值是否仍在斜坡中（尚未到达当前段目标）
+ */
+uint8_t heat_profile_ramping(const HeatProfileRunner *runner);
+/*------------------------------------test------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEAT_PROFILE_H */
@@ -0,0 +1,88 @@
+/**
+ * @file heat_stats.c
+ * @brief 加热能耗与占空比统计
+ *
+ * 加热任务每个控制周期累计一次施加的占空比，能耗按额定功率×占空比×时间折算。
+ * 单次统计仅在RAM中；加热结束时并入累计统计并追加写入Flash。
+ */
+#include "heat_stats.h"
+#include "flash_store.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+static HeatSessionStats  heat_session;  // 单次统计（仅加热任务写）
+static HeatLifetimeStats heat_lifetime; // 累计统计（仅加热任务写）
+
+void heat_stats_init(void)
+{
+    if (flash_store_read(FLASH_STORE_STATS_PAGE, &heat_lifetime, sizeof(heat_lifetime)) != HAL_OK)
+    {
+        memset(&heat_lifetime, 0, sizeof(heat_lifetime)); // 首次使用或记录损坏
+    }
+    memset(&heat_session, 0, sizeof(heat_session));
+}
+
+void heat_stats_begin(void)
+{
+    taskENTER_CRITICAL();
+    memset(&heat_session, 0, sizeof(heat_session));
+    taskEXIT_CRITICAL();
+}
+
+void heat_stats_update(q16_t duty, uint16_t dt_ms, uint8_t at_target)
+{
+    taskENTER_CRITICAL();
+    heat_session.run_ms += dt_ms;
+    heat_session.duty_ms += (uint64_t) duty * dt_ms;
+    if (duty > heat_session.peak_duty) heat_session.peak_duty = duty;
+    if (at_target)
+    {
+        heat_session.at_target_ms += dt_ms;
+        if (heat_session.to_target_ms == 0) heat_session.to_target_ms = heat_session.run_ms;
+    }
+    taskEXIT_CRITICAL();
+}
+
+void heat_stats_end(void)
+{
+    if (heat_session.run_ms == 0) return;
+
+    // 累计统计只由加热任务修改，快照读取方通过临界区保证一致性
+    HeatLifetimeStats total = heat_lifetime;
+    uint16_t          peak = (uint16_t) (((int64_t) heat_session.peak_duty * 10) >> Q16_SHIFT);
+
+    total.sessions++;
+    total.run_s += heat_session.run_ms / 1000U;
+    total.energy_cwh += heat_stats_energy_cwh(heat_session.duty_ms);
+    total.at_target_s += heat_session.at_target_ms / 1000U;
+    if (peak > total.peak_duty_permille) total.peak_duty_permille = peak;
+    if (heat_session.to_target_ms != 0)
+    {
+        uint32_t to_target_s = heat_session.to_target_ms / 1000U;
+        total.to_target_sum_s += to_target_s;
+        total.to_target_count++;
+        if (to_target_s > total.to_target_max_s) total.to_target_max_s = (to_target_s > 0xFFFF) ? 0xFFFF : to_target_s;
+    }
+
+    taskENTER_CRITICAL();
+    heat_lifetime = total;
+    taskEXIT_CRITICAL();
+
+    flash_store_write(FLASH_STORE_STATS_PAGE, &total, sizeof(total));
+}
+
+void heat_stats_snapshot(HeatSessionStats *session, HeatLifetimeStats *lifetime)
+{
+    taskENTER_CRITICAL();
+    if (session != NULL) *session = heat_session;
+    if (lifetime != NULL) *lifetime = heat_lifetime;
+    taskEXIT_CRITICAL();
+}
+
+uint32_t heat_stats_energy_cwh(uint64_t duty_ms)
+{
+    // E(0.01Wh) = P(W) × (占空比%/100) × t(ms) / 3600000 × 100 = P × 占空比%·ms / 3600000
+    return (uint32_t) (((duty_ms >> Q16_SHIFT) * HEAT_RATED_POWER_W) / 3600000U);
+}
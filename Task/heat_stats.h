@@ -0,0 +1,69 @@
+#ifndef HEAT_STATS_H
+#define HEAT_STATS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*----------------------------------include-----------------------------------*/
+#include "fixed.h"
+#include <stdint.h>
+/*-----------------------------------macro------------------------------------*/
+#define HEAT_RATED_POWER_W 10 // 加热片满占空比功率（瓦），按实际加热片修改
+/*----------------------------------typedef-----------------------------------*/
+// 单次加热统计（自启动加热起，停止后保留至下次启动）
+typedef struct
+{
+    uint32_t run_ms;       // 加热时间
+    uint64_t duty_ms;      // 占空比对时间的积分（Q16.16 %·ms）
+    q16_t    peak_duty;    // 峰值占空比（Q16.16 %）
+    uint32_t at_target_ms; // 处于目标温度的时间
+    uint32_t to_target_ms; // 首次到达目标温度用时（0为尚未到达）
+} HeatSessionStats;
+
+// 累计统计（每次加热结束时保存到Flash）
+typedef struct
+{
+    uint32_t sessions;           // 加热次数
+    uint32_t run_s;              // 累计加热时间（秒）
+    uint32_t energy_cwh;         // 累计能耗（0.01Wh）
+    uint32_t at_target_s;        // 累计处于目标温度的时间（秒）
+    uint32_t to_target_sum_s;    // 升温用时累加（秒，用于求平均）
+    uint16_t to_target_count;    // 到达过目标温度的次数
+    uint16_t to_target_max_s;    // 最长升温用时（秒）
+    uint16_t peak_duty_permille; // 历史峰值占空比（0.1%）
+    uint16_t reserved;
+} HeatLifetimeStats;
+/*----------------------------------variable----------------------------------*/
+
+/*-------------------------------------os-------------------------------------*/
+
+/*----------------------------------function----------------------------------*/
+// 从Flash加载累计统计
+void heat_stats_init(void);
+
+// 开始/结束一次加热（结束时累计并保存到Flash）
+void heat_stats_begin(void);
+void heat_stats_end(void);
+
+/**
+ * @brief 累计一个控制周期
+ * @param duty 本周期施加的占空比（Q16.16 %）
+ * @param dt_ms 占空比保持的时间
+ * @param at_target 是否处于目标温度
+ */
+void heat_stats_update(q16_t duty, uint16_t dt_ms, uint8_t at_target);
+
+// 获取统计快照（任意任务可调用）
+void heat_stats_snapshot(HeatSessionStats *session, HeatLifetimeStats *lifetime);
+
+// 单位换算：Q16 %·ms -> 0.01Wh
+uint32_t heat_stats_energy_cwh(uint64_t duty_ms);
+/*------------------------------------test------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEAT_STATS_H */
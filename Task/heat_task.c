@@ -1,131 +1,296 @@
 #include "heat_task.h"
 #include "heat.h"
+#include "heat_ctrl.h"
+#include "heat_profile.h"
+#include "heat_stats.h"
 #include "ntc.h"
 #include "pid.h"
+#include "rtc.h" // 备份寄存器（自整定结果掉电保存）
 
 #include "FreeRTOS.h"
 #include "queue.h"
 #include "semphr.h"
 #include "task.h"
-#include "timers.h"
 #include <stdint.h>
 
 #include "protocal_task.h" // 用于寄存器变更处理
 // 加热控制结构体实例
-Heat_t heat = {.status = HEAT_STOP, .target_temperature = 50.0f, .set_time = 0, .remain_sec = 0};
+Heat_t heat = {.status = HEAT_STOP, .target_temperature = Q16_FROM_INT(50), .set_time = 0};
 
 // 定时相关资源
-static TimerHandle_t     xHeatingTimer = NULL; // 加热定时器句柄
 static SemaphoreHandle_t xHeatMutex = NULL;    // 保护heat结构体的互斥锁
 static QueueHandle_t     xHeatMsgQueue = NULL; // 加热任务消息队列
+static TickType_t        heat_deadline = 0;    // 定时结束时刻（set_time>0且运行时有效）
+
+// 自整定结果保存在备份寄存器：每档两个寄存器（Ku为Q10.6，Tu以100ms为单位），另有一个有效标记寄存器
+#define BKP_TUNE_KU_REG(level) (RTC_BKP_DR3 + (level) * 2) // Ku：DR3/DR5/DR7
+#define BKP_TUNE_TU_REG(level) (RTC_BKP_DR4 + (level) * 2) // Tu：DR4/DR6/DR8
+#define BKP_TUNE_VALID_REG     RTC_BKP_DR9                 // 高字节为标记，低位为各档有效位
+#define BKP_TUNE_MAGIC         0xA500
+#define BKP_TUNE_KU_SHIFT      10                          // Q16.16 -> Q10.6
+
+static HeatCtrl heat_ctrl[HEAT_ZONE_NUM]; // 各区控制律状态（仅加热任务与初始化访问）
+static uint8_t  heat_tune_request = 0;    // 自整定请求（受xHeatMutex保护）
+
+// 加热曲线（受xHeatMutex保护）
+static uint8_t heat_profile_request = HEAT_PROFILE_NONE;          // 请求执行的曲线编号
+static uint8_t heat_shortcut_profile[HEAT_SHORTCUT_NUM] = {1, 2}; // 各快捷键对应的曲线编号
+
+// NTC两点校准请求（受xHeatMutex保护）：查找表只由加热任务读取，采集和重建查找表也在加热任务中执行
+typedef enum
+{
+    HEAT_CAL_REQ_NONE = 0,
+    HEAT_CAL_REQ_POINT1,
+    HEAT_CAL_REQ_POINT2,
+    HEAT_CAL_REQ_CLEAR
+} HeatCalRequest;
+
+static HeatCalRequest heat_cal_request = HEAT_CAL_REQ_NONE; // 待执行的校准操作
+static q16_t          heat_cal_reference = 0;               // 采集点的参考温度
+
+// 加热状态切换回调（默认为空，宿主机仿真可挂接以记录状态变化）
+static HeatStatusHook heat_status_hook = NULL;
 
 // 消息类型定义
 typedef enum
 {
-    MSG_TIMER_EXPIRE = 0x01, // 定时结束消息
-    MSG_UPDATE_REMAIN = 0x02 // 更新剩余时间消息
+    MSG_STATUS_CHANGE = 0x01 // 外部启停命令（唤醒任务）
 } HeatMsgType;
 
-// 定时器回调函数：定时结束时发送消息
-static void heating_timer_callback(TimerHandle_t xTimer)
+// 内部函数：切换加热状态并通知回调（调用方需持有xHeatMutex）
+static void heat_change_status(HeatStatus status)
 {
-    (void) xTimer;
-    HeatMsgType msg = MSG_TIMER_EXPIRE;
-    xQueueSend(xHeatMsgQueue, &msg, 0); // 非阻塞发送
+    HeatStatus old = heat.status;
+    heat.status = status;
+    if (status == HEAT_STOP)
+    {
+        // 停止加热同时取消自整定和加热曲线
+        heat_tune_request = 0;
+        heat_profile_request = HEAT_PROFILE_NONE;
+    }
+    if (old != status && heat_status_hook != NULL) heat_status_hook(old, status);
 }
 
-// 定时更新剩余时间的软件定时器（1秒一次）
-static TimerHandle_t xRemainTimer = NULL;
+void heat_set_status_hook(HeatStatusHook hook)
+{
+    heat_status_hook = hook;
+}
+
+// 内部函数：按当前时刻设置定时结束时刻（调用方需持有xHeatMutex）
+static void heat_arm_deadline(void)
+{
+    // 直接按秒换算节拍，避免pdMS_TO_TICKS在长定时下的32位乘法溢出
+    heat_deadline = xTaskGetTickCount() + (TickType_t) heat.set_time * 60 * configTICK_RATE_HZ;
+}
 
-static void remain_timer_callback(TimerHandle_t xTimer)
+// 内部函数：由备份寄存器中的整定结果计算指定档位增益，无效时使用默认增益
+// 各区加热片结构相同且备份寄存器只够保存一组结果，整定在区0进行，增益用于所有区
+static void heat_gains_load(HeatLevel level)
 {
-    (void) xTimer;
-    HeatMsgType msg = MSG_UPDATE_REMAIN;
-    xQueueSend(xHeatMsgQueue, &msg, 0); // 非阻塞发送
+    uint32_t  valid = HAL_RTCEx_BKUPRead(&hrtc, BKP_TUNE_VALID_REG);
+    HeatGains gains = heat_default_gains;
+
+    if ((valid & 0xFF00) == BKP_TUNE_MAGIC && (valid & (1U << level)) != 0)
+    {
+        q16_t    Ku = (q16_t) (HAL_RTCEx_BKUPRead(&hrtc, BKP_TUNE_KU_REG(level)) << BKP_TUNE_KU_SHIFT);
+        uint32_t Tu_ms = HAL_RTCEx_BKUPRead(&hrtc, BKP_TUNE_TU_REG(level)) * HEAT_CONTROL_PERIOD_MS;
+        PID_Tune_Gains(Ku, Tu_ms, &gains.Kp, &gains.Ki, &gains.Kd);
+    }
+    for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++) { heat_ctrl[zone].gains[level] = gains; }
+}
+
+// 内部函数：保存指定档位的整定结果并更新增益
+static void heat_gains_save(HeatLevel level, q16_t Ku, uint32_t Tu_ms)
+{
+    uint32_t ku = (uint32_t) Ku >> BKP_TUNE_KU_SHIFT;
+    uint32_t tu = Tu_ms / HEAT_CONTROL_PERIOD_MS;
+    uint32_t valid = HAL_RTCEx_BKUPRead(&hrtc, BKP_TUNE_VALID_REG);
+
+    if ((valid & 0xFF00) != BKP_TUNE_MAGIC) valid = BKP_TUNE_MAGIC;
+    HAL_RTCEx_BKUPWrite(&hrtc, BKP_TUNE_KU_REG(level), (ku > 0xFFFF) ? 0xFFFF : ku);
+    HAL_RTCEx_BKUPWrite(&hrtc, BKP_TUNE_TU_REG(level), (tu > 0xFFFF) ? 0xFFFF : tu);
+    HAL_RTCEx_BKUPWrite(&hrtc, BKP_TUNE_VALID_REG, valid | (1U << level));
+
+    heat_gains_load(level); // 按保存后的精度重新计算，保证与上电加载结果一致
+}
+
+// 内部函数：结束自整定，成功则保存结果，失败则停止加热
+static void heat_tune_finish(HeatLevel level, const PID_Tuner *tuner, PID_TuneState state)
+{
+    if (state == PID_TUNE_DONE) heat_gains_save(level, tuner->Ku, tuner->Tu_ms);
+
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    heat_tune_request = 0;
+    if (state != PID_TUNE_DONE) heat_change_status(HEAT_STOP);
+    xSemaphoreGive(xHeatMutex);
+}
+
+// 内部函数：加热曲线执行完毕，结束本次加热
+static void heat_profile_finish(void)
+{
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    heat_change_status(HEAT_STOP);
+    xSemaphoreGive(xHeatMutex);
 }
 
 // 加热控制任务：整合PID控制与定时逻辑
+// 停止时无限期阻塞在消息队列上（无周期唤醒）；运行时以控制周期为截止时间等待消息，
+// 超温由ADC模拟看门狗在中断中直接关断输出，任务在下一次唤醒时同步为停止状态；
+// 到期执行一次控制。命令通过MSG_STATUS_CHANGE唤醒任务，一个控制周期内生效。
+// 定时结束在每次唤醒时对照heat_deadline判断，无需额外的软件定时器。
+// 控制律（PID、自整定、热模型与加热曲线）在heat_ctrl中实现，本任务负责时序、
+// 测温、硬件输出以及整定结果保存、停止加热等副作用。
+// 各加热区共用目标温度和加热曲线，各自独立测温和控制，按最短的区控制周期统一调度。
 void heat_control_task(void *arg)
 {
     (void) arg;
-    static TickType_t xLastWakeTime = 0;
-    xLastWakeTime = xTaskGetTickCount();
-    PID_Controller heater_pid;
-    PID_Init(&heater_pid, 10.0f, 0.1f, 4.5f, 50.0f, 0.0f, 100.0f);
+    HeatStatus active = HEAT_STOP;         // 任务当前执行的状态
+    TickType_t next_control = 0;           // 下一次控制时刻
+    q16_t      applied_target = INT32_MIN; // 上次快照的目标温度
+    HeatLevel  tune_level = HEAT_LEVEL_1;  // 自整定对应的档位
 
     for (;;)
     {
-        // 处理消息队列（优先处理定时相关事件）
+        // 计算等待时间：停止时永久阻塞，运行时等到下一次控制时刻
+        TickType_t wait = portMAX_DELAY;
+        if (active == HEAT_RUNNING)
+        {
+            TickType_t now = xTaskGetTickCount();
+            wait = ((int32_t) (next_control - now) > 0) ? (TickType_t) (next_control - now) : 0;
+        }
+
         HeatMsgType msg;
-        if (xQueueReceive(xHeatMsgQueue, &msg, 0) == pdTRUE)
+        BaseType_t  got = xQueueReceive(xHeatMsgQueue, &msg, wait);
+
+        // 清空唤醒消息（仅用于唤醒，状态在下方快照中获取）
+        while (got == pdTRUE) { got = xQueueReceive(xHeatMsgQueue, &msg, 0); }
+
+        // 一次加锁内检查定时是否结束并获取状态快照
+        xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+        if (heat.status == HEAT_RUNNING && heat.set_time > 0 &&
+            (int32_t) (xTaskGetTickCount() - heat_deadline) >= 0)
+        {
+            // 定时结束：关闭加热
+            heat_change_status(HEAT_STOP);
+            heat.set_time = 0;
+        }
+        if (heat.status == HEAT_RUNNING && heat_fault_get() != HEAT_FAULT_NONE)
         {
-            xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+            // 硬件超温关断已清零输出，此处同步停止状态
+            heat_change_status(HEAT_STOP);
+            heat.set_time = 0;
+        }
+        HeatStatus status = heat.status;
+        HeatLevel  level = heat.level;
+        q16_t      target_temp = heat.target_temperature;
+        uint8_t    tune_req = heat_tune_request;
+        uint8_t    profile_req = heat_profile_request;
+        uint8_t    cal_req = heat_cal_request;
+        q16_t      cal_reference = heat_cal_reference;
+        heat_cal_request = HEAT_CAL_REQ_NONE;
+        xSemaphoreGive(xHeatMutex);
 
-            switch (msg)
+        // NTC校准：采集当前读数；第二点完成后新查找表从下一次测温起生效
+        if (cal_req == HEAT_CAL_REQ_POINT1) { NTC_CalCapture(1, cal_reference); }
+        else if (cal_req == HEAT_CAL_REQ_POINT2) { NTC_CalCapture(2, cal_reference); }
+        else if (cal_req == HEAT_CAL_REQ_CLEAR) { NTC_CalClear(); }
+
+        // 状态切换：停止时关闭硬件一次，启动时立即执行首次控制；
+        // 控制器与NTC滤波链同时复位，首次控制不使用停止前的滤波状态
+        if (status != active)
+        {
+            active = status;
+            for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++) { heat_ctrl_start(&heat_ctrl[zone]); }
+            NTC_FilterReset();
+            if (active == HEAT_RUNNING)
             {
-                case MSG_TIMER_EXPIRE:
-                    // 定时结束：关闭加热
-                    heat.status = HEAT_STOP;
-                    heat.remain_sec = 0;
-                    heat.set_time = 0;
-                    heat_off();                  // 关闭硬件加热
-                    xTimerStop(xRemainTimer, 0); // 停止剩余时间更新
-                    break;
+                next_control = xTaskGetTickCount();
+                heat_stats_begin();
+            }
+            else
+            {
+                for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++) { heat_off(zone); }
+                heat_stats_end(); // 累计本次统计并保存
+            }
+        }
 
-                case MSG_UPDATE_REMAIN:
-                    // 每秒更新剩余时间
-                    if (heat.status == HEAT_RUNNING && heat.remain_sec > 0)
-                    {
-                        heat.remain_sec--;
-                        // 剩余时间为0时触发定时结束（双重保障）
-                        if (heat.remain_sec == 0)
-                        {
-                            heat.status = HEAT_STOP;
-                            heat.set_time = 0;
-                            heat_off();
-                            xTimerStop(xRemainTimer, 0);
-                            xTimerStop(xHeatingTimer, 0);
-                        }
-                    }
-                    break;
+        // 自整定请求变化（仅区0）：开始时以当前目标温度为整定设定值，取消时恢复PID控制
+        if (tune_req != heat_ctrl[0].tuning)
+        {
+            if (tune_req) tune_level = level;
+            heat_ctrl_set_tuning(&heat_ctrl[0], tune_req, target_temp);
+        }
+
+        // 曲线请求变化：新曲线在下次控制时从当前测量温度起步
+        if (profile_req != heat_ctrl[0].profile_id)
+        {
+            for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++)
+            {
+                heat_ctrl_set_profile(&heat_ctrl[zone], profile_req);
             }
+            applied_target = INT32_MIN;
+        }
 
-            xSemaphoreGive(xHeatMutex);
+        // 目标温度变化：恢复快速周期并立即执行一次控制
+        if (target_temp != applied_target)
+        {
+            applied_target = target_temp;
+            for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++) { heat_ctrl_retarget(&heat_ctrl[zone]); }
+            if (active == HEAT_RUNNING) { next_control = xTaskGetTickCount(); }
         }
 
-        // 执行PID温度控制（仅在运行状态）
-        xSemaphoreTake(xHeatMutex, portMAX_DELAY);
-        HeatStatus current_status = heat.status;
-        float      target_temp = heat.target_temperature;
-        xSemaphoreGive(xHeatMutex);
+        // 执行温度控制（仅在运行状态且到达控制时刻）
+        if (active != HEAT_RUNNING || (int32_t) (xTaskGetTickCount() - next_control) < 0) continue;
 
-        if (current_status == HEAT_RUNNING)
+        q16_t    output_sum = 0;
+        uint8_t  at_target = 1;
+        uint16_t period_ms = HEAT_CONTROL_SLOW_MS;
+
+        for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++)
         {
-            float current_temp;
-            int   ret = NTC_Read(&current_temp);
+            HeatCtrl     *ctrl = &heat_ctrl[zone];
+            q16_t         current_temp;
+            int           ret = NTC_Read(zone, &current_temp);
+            HeatCtrlEvent event = heat_ctrl_step(ctrl, (ret == 0) ? &current_temp : NULL, target_temp);
 
-            if (ret != 0)
+            switch (event)
             {
-                PID_Reset(&heater_pid);
-                heat_off(); // 温度读取失败时关闭加热
+                case HEAT_CTRL_EVENT_TUNE_DONE:
+                    heat_tune_finish(tune_level, &ctrl->tuner, PID_TUNE_DONE);
+                    break;
+                case HEAT_CTRL_EVENT_TUNE_FAILED:
+                    heat_tune_finish(tune_level, &ctrl->tuner, PID_TUNE_FAILED);
+                    break;
+                case HEAT_CTRL_EVENT_PROFILE_END:
+                    heat_profile_finish(); // 曲线执行完毕：结束本次加热
+                    break;
+                default:
+                    break;
             }
-            else
+
+            if (ctrl->output > 0)
             {
-                float pid_output = PID(&heater_pid, current_temp, target_temp, 100);
-                if (pid_output > 0)
-                {
-                    heat_on(pid_output); // 按PID输出控制加热强度
-                }
-                else { heat_off(); }
+                heat_on_q16(zone, ctrl->output); // 按控制输出设置加热强度
             }
+            else { heat_off(zone); } // 温度读取失败或输出为0时关闭加热
+
+            output_sum += ctrl->output;
+            if (!ctrl->at_target) at_target = 0;
+            if (ctrl->period_ms < period_ms) period_ms = ctrl->period_ms;
         }
-        else
+
+        // 各区按统一周期执行，下一次控制的时间间隔以该周期为准
+        for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++) { heat_ctrl[zone].period_ms = period_ms; }
+
+        // 本周期输出将保持到下一次控制，按下一周期长度累计能耗与占空比统计（占空比取各区平均）
+        heat_stats_update(output_sum / HEAT_ZONE_NUM, period_ms, at_target);
+
+        // 推进控制时刻；若落后超过一个周期则重新对齐，避免连续补跑
+        next_control += pdMS_TO_TICKS(period_ms);
+        if ((int32_t) (xTaskGetTickCount() - next_control) >= 0)
         {
-            heat_off(); // 非运行状态关闭加热
+            next_control = xTaskGetTickCount() + pdMS_TO_TICKS(period_ms);
         }
-
-        // 100ms周期阻塞（保证控制频率）
-        vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(100));
     }
 }
 
@@ -140,18 +305,16 @@ void heat_task_init(void)
     xHeatMsgQueue = xQueueCreate(5, sizeof(HeatMsgType));
     configASSERT(xHeatMsgQueue != NULL);
 
-    // 创建加热定时主定时器（一次性触发）
-    xHeatingTimer = xTimerCreate("HeatingTimer",
-                                 pdMS_TO_TICKS(1000), // 初始周期（后续动态修改）
-                                 pdFALSE, (void *) 0, heating_timer_callback);
-    configASSERT(xHeatingTimer != NULL);
+    // 启动各区NTC采样和加热输出
+    NTC_Init();
+    heat_init();
 
-    // 创建剩余时间更新定时器（1秒周期触发）
-    xRemainTimer = xTimerCreate("RemainTimer",
-                                pdMS_TO_TICKS(1000), // 1秒周期
-                                pdTRUE,              // 自动重载
-                                (void *) 1, remain_timer_callback);
-    configASSERT(xRemainTimer != NULL);
+    // 加载累计加热统计
+    heat_stats_init();
+
+    // 初始化控制律并加载各档位自整定结果（无效时使用默认增益）
+    for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++) { heat_ctrl_init(&heat_ctrl[zone]); }
+    for (uint8_t i = 0; i < HEAT_LEVEL_NUM; i++) { heat_gains_load((HeatLevel) i); }
 
     // 创建加热控制任务
     xTaskCreate(heat_control_task, "heat_task",
@@ -166,57 +329,54 @@ void heat_set_timer(uint16_t minute)
 {
     xSemaphoreTake(xHeatMutex, portMAX_DELAY);
 
-    // 更新定时参数
+    // 更新定时参数（限幅到上限）；运行中则从当前时刻重新计时，为0表示不定时
+    if (minute > HEAT_TIMER_MAX_MIN) minute = HEAT_TIMER_MAX_MIN;
     heat.set_time = minute;
-    heat.remain_sec = (uint32_t) minute * 60; // 转换为秒
+    if (minute > 0 && heat.status == HEAT_RUNNING) { heat_arm_deadline(); }
 
-    if (minute > 0 && heat.status == HEAT_RUNNING)
-    {
-        // 启动/重置主定时器（定时时间=总秒数）
-        xTimerStop(xHeatingTimer, 0);
-        xTimerChangePeriod(xHeatingTimer, pdMS_TO_TICKS(heat.remain_sec * 1000), 0);
-        xTimerStart(xHeatingTimer, 0);
+    xSemaphoreGive(xHeatMutex);
+}
 
-        // 启动剩余时间更新定时器
-        if (xTimerIsTimerActive(xRemainTimer) == pdFALSE) { xTimerStart(xRemainTimer, 0); }
-    }
-    else
+// 获取剩余加热时间（秒，向上取整；未定时或停止时为0）
+uint32_t heat_get_remain_sec(void)
+{
+    uint32_t remain = 0;
+
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    if (heat.status == HEAT_RUNNING && heat.set_time > 0)
     {
-        // 定时为0时停止定时器
-        xTimerStop(xHeatingTimer, 0);
-        xTimerStop(xRemainTimer, 0);
+        int32_t ticks = (int32_t) (heat_deadline - xTaskGetTickCount());
+        if (ticks > 0) remain = ((uint32_t) ticks + configTICK_RATE_HZ - 1) / configTICK_RATE_HZ;
     }
-
     xSemaphoreGive(xHeatMutex);
+
+    return remain;
 }
 
-// 启动/停止加热（外部调用接口）
-void heat_set_status(HeatStatus status)
+// 内部函数：启动/停止加热（调用方需持有xHeatMutex），超温故障锁存期间不能启动，返回是否已切换
+static bool heat_apply_status(HeatStatus status)
 {
-    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    if (status == HEAT_RUNNING && heat_fault_get() != HEAT_FAULT_NONE) return false;
 
-    heat.status = status;
-    if (status == HEAT_STOP)
-    {
-        // 停止加热时关闭所有定时器
-        xTimerStop(xHeatingTimer, 0);
-        xTimerStop(xRemainTimer, 0);
-        heat.remain_sec = 0;
-        heat.set_time = 0;
-    }
-    else
-    {
-        // 启动加热时，如果有定时设置则启动定时器
-        if (heat.set_time > 0)
-        {
-            heat.remain_sec = (uint32_t) heat.set_time * 60;
-            xTimerChangePeriod(xHeatingTimer, pdMS_TO_TICKS(heat.remain_sec * 1000), 0);
-            xTimerStart(xHeatingTimer, 0);
-            xTimerStart(xRemainTimer, 0);
-        }
-    }
+    // 停止时清除定时；启动时若有定时设置则从当前时刻开始计时
+    if (status == HEAT_STOP) { heat.set_time = 0; }
+    else if (heat.status != HEAT_RUNNING && heat.set_time > 0) { heat_arm_deadline(); }
+    heat_change_status(status);
+    return true;
+}
 
+// 启动/停止加热（外部调用接口），返回false表示因超温故障未能启动
+bool heat_set_status(HeatStatus status)
+{
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    bool ok = heat_apply_status(status);
     xSemaphoreGive(xHeatMutex);
+    if (!ok) return false;
+
+    // 唤醒加热任务（队列满时任务已有待处理消息，同样会重新读取状态）
+    HeatMsgType msg = MSG_STATUS_CHANGE;
+    xQueueSend(xHeatMsgQueue, &msg, 0);
+    return true;
 }
 void heat_status_switch(void)
 {
@@ -229,27 +389,21 @@ void heat_status_switch(void)
     else
         heat_set_status(HEAT_RUNNING);
 }
+// 清除超温故障（外部调用接口）：若仍超温，下一次ADC转换即再次关断
+void heat_clear_fault(void)
+{
+    heat_fault_clear();
+    NTC_WatchdogRearm();
+}
+
 // 设置加热档位（外部调用接口）
 void heat_set_level(HeatLevel level)
 {
     xSemaphoreTake(xHeatMutex, portMAX_DELAY);
 
-    switch (level)
-    {
-        case HEAT_LEVEL_1:
-            heat.target_temperature = 35.0f;
-            break;
-        case HEAT_LEVEL_2:
-            heat.target_temperature = 45.0f;
-            break;
-        case HEAT_LEVEL_3:
-            heat.target_temperature = 55.0f;
-            break;
-        default:
-            heat.target_temperature = 0.0f;
-            break;
-    }
+    heat.target_temperature = (level < HEAT_LEVEL_NUM) ? heat_level_temp[level] : 0;
     heat.level = level;
+    heat_profile_request = HEAT_PROFILE_NONE; // 手动调档取消加热曲线
     xSemaphoreGive(xHeatMutex);
 }
 void heat_level_up(void)
@@ -265,3 +419,110 @@ void heat_level_down(void)
     if (level < HEAT_LEVEL_1) level = HEAT_LEVEL_1;
     heat_set_level((HeatLevel) level);
 }
+
+// 启动/取消PID自整定（启动时同时开启加热，以当前档位目标温度整定）
+// 加热与整定请求在同一临界区内设置：超温故障锁存导致加热未启动时不留下整定请求，返回false
+bool heat_set_autotune(uint8_t enable)
+{
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    bool ok = !enable || heat_apply_status(HEAT_RUNNING);
+    if (ok)
+    {
+        heat_tune_request = enable ? 1 : 0;
+        if (enable) heat_profile_request = HEAT_PROFILE_NONE; // 自整定与加热曲线互斥
+    }
+    xSemaphoreGive(xHeatMutex);
+    if (!ok) return false;
+
+    HeatMsgType msg = MSG_STATUS_CHANGE;
+    xQueueSend(xHeatMsgQueue, &msg, 0);
+    return true;
+}
+
+// 查询自整定是否进行中（整定完成、失败或停止加热后为0）
+uint8_t heat_get_autotune(void)
+{
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    uint8_t active = heat_tune_request;
+    xSemaphoreGive(xHeatMutex);
+
+    return active;
+}
+
+// 执行/取消加热曲线（启动时同时开启加热，HEAT_PROFILE_NONE为取消）
+// 与自整定相同，加热未能启动（超温故障锁存）时不留下曲线请求，返回false
+bool heat_set_profile(uint8_t id)
+{
+    if (id != HEAT_PROFILE_NONE && heat_profile_get(id) == NULL) return false;
+
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    bool ok = (id == HEAT_PROFILE_NONE) || heat_apply_status(HEAT_RUNNING);
+    if (ok)
+    {
+        heat_profile_request = id;
+        if (id != HEAT_PROFILE_NONE) heat_tune_request = 0;
+    }
+    xSemaphoreGive(xHeatMutex);
+    if (!ok) return false;
+
+    HeatMsgType msg = MSG_STATUS_CHANGE;
+    xQueueSend(xHeatMsgQueue, &msg, 0);
+    return true;
+}
+
+// 查询正在执行的加热曲线编号（曲线结束、调档或停止加热后为HEAT_PROFILE_NONE）
+uint8_t heat_get_profile(void)
+{
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    uint8_t id = heat_profile_request;
+    xSemaphoreGive(xHeatMutex);
+
+    return id;
+}
+
+// NTC两点校准采集（point为1或2，参考温度为Q16.16℃）；结果通过NTC_CalGetState查询
+void heat_ntc_calibrate(uint8_t point, q16_t reference)
+{
+    if (point != 1 && point != 2) return;
+
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    heat_cal_request = (point == 1) ? HEAT_CAL_REQ_POINT1 : HEAT_CAL_REQ_POINT2;
+    heat_cal_reference = reference;
+    xSemaphoreGive(xHeatMutex);
+
+    HeatMsgType msg = MSG_STATUS_CHANGE;
+    xQueueSend(xHeatMsgQueue, &msg, 0);
+}
+
+// 清除NTC校准，恢复标称参数
+void heat_ntc_calibration_clear(void)
+{
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    heat_cal_request = HEAT_CAL_REQ_CLEAR;
+    xSemaphoreGive(xHeatMutex);
+
+    HeatMsgType msg = MSG_STATUS_CHANGE;
+    xQueueSend(xHeatMsgQueue, &msg, 0);
+}
+
+// 配置快捷键对应的加热曲线（slot为1~HEAT_SHORTCUT_NUM）
+void heat_set_shortcut(uint8_t slot, uint8_t profile_id)
+{
+    if (slot == 0 || slot > HEAT_SHORTCUT_NUM || profile_id > HEAT_PROFILE_NUM) return;
+
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    heat_shortcut_profile[slot - 1] = profile_id;
+    xSemaphoreGive(xHeatMutex);
+}
+
+// 执行快捷键对应的加热曲线
+void heat_run_shortcut(uint8_t slot)
+{
+    if (slot == 0 || slot > HEAT_SHORTCUT_NUM) return;
+
+    xSemaphoreTake(xHeatMutex, portMAX_DELAY);
+    uint8_t id = heat_shortcut_profile[slot - 1];
+    xSemaphoreGive(xHeatMutex);
+
+    if (id != HEAT_PROFILE_NONE) heat_set_profile(id);
+}
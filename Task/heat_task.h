@@ -1,8 +1,13 @@
 #ifndef HEAT_TASK_H
 #define HEAT_TASK_H
 
+#include "fixed.h"
+#include <stdbool.h>
 #include <stdint.h>
 
+#define HEAT_SHORTCUT_NUM  2   // 快捷键数量
+#define HEAT_TIMER_MAX_MIN 120 // 定时上限（分钟），远小于32位节拍计数可表示的时长
+
 // 加热状态枚举
 typedef enum
 {
@@ -13,7 +18,8 @@ typedef enum
 {
     HEAT_LEVEL_1,
     HEAT_LEVEL_2,
-    HEAT_LEVEL_3
+    HEAT_LEVEL_3,
+    HEAT_LEVEL_NUM // 档位数量
 } HeatLevel;
 
 // 外部声明加热控制结构体
@@ -21,19 +27,24 @@ typedef struct
 {
     HeatStatus status; // 加热状态（0-停止，1-运行）
     HeatLevel  level;
-    float      target_temperature; // 目标温度
+    q16_t      target_temperature; // 目标温度（Q16.16，℃）
     uint16_t   set_time;           // 设置的定时时间（分钟）
-    uint32_t   remain_sec;         // 剩余时间（秒）
 } Heat_t;
 
+// 加热状态切换回调类型（持有加热互斥锁时调用，不可阻塞）
+typedef void (*HeatStatusHook)(HeatStatus old_status, HeatStatus new_status);
+
 // 初始化加热任务及定时相关资源
 void heat_task_init(void);
 
-// 设置加热定时（外部调用，如Modbus任务）
+// 设置加热定时（外部调用，如Modbus任务；超过HEAT_TIMER_MAX_MIN按上限处理）
 void heat_set_timer(uint16_t minute);
 
-// 启动/停止加热（外部调用）
-void heat_set_status(HeatStatus status);
+// 获取剩余加热时间（秒），由定时结束时刻推算
+uint32_t heat_get_remain_sec(void);
+
+// 启动/停止加热（外部调用；存在超温故障时不能启动，返回false）
+bool heat_set_status(HeatStatus status);
 void heat_status_switch(void);
 
 // 设置加热档位（外部调用）
@@ -41,4 +52,26 @@ void heat_set_level(HeatLevel level);
 void heat_level_up(void);
 void heat_level_down(void);
 
+// 启动/取消PID继电反馈自整定（结果按档位保存，用于按目标温度的增益调度）；查询是否进行中
+bool    heat_set_autotune(uint8_t enable);
+uint8_t heat_get_autotune(void);
+
+// 执行/取消加热曲线（编号见heat_profile.h，0为取消）；查询正在执行的曲线
+bool    heat_set_profile(uint8_t id);
+uint8_t heat_get_profile(void);
+
+// 清除超温故障锁存并重新使能硬件超温关断
+void heat_clear_fault(void);
+
+// NTC两点校准：各区处于参考温度时依次采集第1、2点，完成后修正量保存并并入查找表
+void heat_ntc_calibrate(uint8_t point, q16_t reference);
+void heat_ntc_calibration_clear(void);
+
+// 配置/执行快捷键对应的加热曲线（slot为1~HEAT_SHORTCUT_NUM）
+void heat_set_shortcut(uint8_t slot, uint8_t profile_id);
+void heat_run_shortcut(uint8_t slot);
+
+// 注册加热状态切换回调（用于仿真/日志记录）
+void heat_set_status_hook(HeatStatusHook hook);
+
 #endif // HEAT_TASK_H
@@ -20,6 +20,8 @@ void key_scan(void *arg)
     xLastWakeTime = xTaskGetTickCount();
     static unsigned char before = 0;
 
+    key_init(); // 配置按键矩阵引脚
+
     for (;;)
     {
         unsigned char now = get_key();
@@ -111,10 +113,10 @@ void key_event_handler(uint8_t key_id, key_event_t event)
                     heat_status_switch();
                     break;
                 case KEY_SHORTCUT_1:
-                    // 短按处理
+                    heat_run_shortcut(1);
                     break;
                 case KEY_SHORTCUT_2:
-                    // 短按处理
+                    heat_run_shortcut(2);
                     break;
                 case KEY_POWER:
                     // 短按处理
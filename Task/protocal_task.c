@@ -4,6 +4,11 @@
 // #include "alarm.h" // 闹钟处理
 #include "bt401.h"
 #include "crc16.h"
+#include "heat.h"         // 加热故障锁存
+#include "heat_profile.h" // 加热曲线编号范围
+#include "heat_stats.h"   // 加热统计寄存器
+#include "heat_task.h"    // 快捷键执行
+#include "ntc.h"          // NTC校准状态
 #include "rtc.h" // UTC时间处理
 #include "task.h"
 
@@ -16,21 +21,84 @@
 #define MODBUS_EXCEPTION_ILLEGAL_ADDR  0x02 // 非法地址
 #define MODBUS_EXCEPTION_ILLEGAL_VAL   0x03 // 非法值
 
+#define RTC_WRITE_POLL_MS 10 // RTC计数器写入未完成时的轮询间隔(ms)
+
 extern void do_reg_change_actions(RegisterID reg, uint16_t value);
 // 全局寄存器存储（私有，仅通过内部接口访问）
-static uint16_t g_registers[REG_COUNT] = {0};
+static uint16_t g_registers[REG_COUNT] = {
+    [REG_SHORTCUT_KEY1] = 1, // 默认快捷键1执行曲线1
+    [REG_SHORTCUT_KEY2] = 2, // 默认快捷键2执行曲线2
+};
 
 // -------------------------- 模块化辅助函数 --------------------------
+// 统计值饱和到16位
+static uint16_t _stat_u16(uint32_t value)
+{
+    return (value > 0xFFFF) ? 0xFFFF : (uint16_t) value;
+}
+
+// 统计寄存器（REG_STAT_SESSION_ENERGY ~ REG_STAT_MAX_TO_TARGET，之后追加的寄存器不属于统计区）
+static bool _register_is_stat(RegisterID reg_id)
+{
+    return reg_id >= REG_STAT_SESSION_ENERGY && reg_id <= REG_STAT_MAX_TO_TARGET;
+}
+
+// 0. 统计寄存器读操作（由加热统计实时换算，不占用g_registers）
+static uint16_t _register_get_stat(RegisterID reg_id)
+{
+    HeatSessionStats  session;
+    HeatLifetimeStats total;
+    heat_stats_snapshot(&session, &total);
+
+    switch (reg_id)
+    {
+        case REG_STAT_SESSION_ENERGY:
+            return _stat_u16(heat_stats_energy_cwh(session.duty_ms));
+        case REG_STAT_SESSION_MEAN_DUTY:
+            // Q16 %·ms / ms -> 0.1%
+            return (session.run_ms == 0) ? 0 : _stat_u16((uint32_t) ((session.duty_ms * 10U / session.run_ms) >> 16));
+        case REG_STAT_SESSION_PEAK_DUTY:
+            return _stat_u16((uint32_t) (((int64_t) session.peak_duty * 10) >> 16));
+        case REG_STAT_SESSION_AT_TARGET:
+            return _stat_u16(session.at_target_ms / 1000U);
+        case REG_STAT_SESSION_TO_TARGET:
+            return _stat_u16((session.to_target_ms + 999U) / 1000U);
+        case REG_STAT_TOTAL_SESSIONS:
+            return _stat_u16(total.sessions);
+        case REG_STAT_TOTAL_ENERGY_HIGH:
+            return (uint16_t) (total.energy_cwh >> 16);
+        case REG_STAT_TOTAL_ENERGY_LOW:
+            return (uint16_t) (total.energy_cwh & 0xFFFF);
+        case REG_STAT_TOTAL_RUN_TIME:
+            return _stat_u16(total.run_s / 360U);
+        case REG_STAT_TOTAL_AT_TARGET:
+            return _stat_u16(total.at_target_s / 360U);
+        case REG_STAT_AVG_TO_TARGET:
+            return (total.to_target_count == 0) ? 0 : _stat_u16(total.to_target_sum_s / total.to_target_count);
+        case REG_STAT_MAX_TO_TARGET:
+            return total.to_target_max_s;
+        default:
+            return 0;
+    }
+}
+
 // 1. 寄存器读操作（统一封装，含读权限校验）
-static uint16_t _register_get_value(RegisterID reg_id)
+static bool _register_get_value(RegisterID reg_id, uint16_t *value)
 {
     // 合法性检查：寄存器ID超出范围
-    if (reg_id >= REG_COUNT) return 0xFFFF; // 自定义非法值标识
+    if (reg_id >= REG_COUNT) return false;
 
     // 读权限检查：REG_EXECUTE_SHORTCUT及之前为只写寄存器，禁止读
-    if (reg_id <= REG_EXECUTE_SHORTCUT) return 0xFFFF;
+    if (reg_id <= REG_EXECUTE_SHORTCUT) return false;
 
-    return g_registers[reg_id];
+    // 统计寄存器可取任意16位值（如能耗低位），因此以返回值而非0xFFFF表示非法
+    if (_register_is_stat(reg_id)) *value = _register_get_stat(reg_id);
+    else if (reg_id == REG_HEATING_AUTOTUNE) *value = heat_get_autotune();        // 整定结束或停止加热后自动清零
+    else if (reg_id == REG_HEATING_PROFILE) *value = heat_get_profile();          // 曲线结束、调档或停止后自动清零
+    else if (reg_id == REG_HEATING_FAULT) *value = (uint16_t) heat_fault_get();  // 故障由中断锁存，读取实时值
+    else if (reg_id == REG_NTC_CAL_STATE) *value = (uint16_t) NTC_CalGetState(); // 校准在加热任务中异步完成
+    else *value = g_registers[reg_id];
+    return true;
 }
 
 // 2. 普通寄存器写操作（不含特殊逻辑，含值范围校验）
@@ -42,6 +110,9 @@ static bool _register_set_normal(RegisterID reg_id, uint16_t value)
     // 特殊只写寄存器禁止通过"普通写"操作处理（需单独逻辑）
     if (reg_id <= REG_EXECUTE_SHORTCUT) return false;
 
+    // 统计寄存器只读
+    if (_register_is_stat(reg_id)) return false;
+
     // 值范围校验（根据寄存器功能限制）
     switch (reg_id)
     {
@@ -49,11 +120,29 @@ static bool _register_set_normal(RegisterID reg_id, uint16_t value)
             if (value < 0 || value > 2) return false; // 热敷档位1-5
             break;
         case REG_HEATING_TIMER:
-            if (value > 0xffff) return false; // 定时0-120分钟（0=无定时）
+            if (value > HEAT_TIMER_MAX_MIN) return false; // 定时0-120分钟（0=无定时）
             break;
         case REG_HEATING_STATUS:
             if (value > 1) return false; // 状态0=关闭，1=开启
             break;
+        case REG_HEATING_AUTOTUNE:
+            if (value > 1) return false; // 0=取消，1=启动自整定
+            break;
+        case REG_SHORTCUT_KEY1:
+        case REG_SHORTCUT_KEY2:
+        case REG_HEATING_PROFILE:
+            if (value > HEAT_PROFILE_NUM) return false; // 加热曲线编号（0=无）
+            break;
+        case REG_HEATING_FAULT:
+            if (value != 0) return false; // 只能写0清除故障
+            break;
+        case REG_NTC_CAL_POINT1:
+        case REG_NTC_CAL_POINT2:
+            if (value > 1000) return false; // 参考温度0~100.0℃
+            break;
+        case REG_NTC_CAL_STATE:
+            if (value != 0) return false; // 只能写0清除校准
+            break;
         default:
             break; // 其他读写寄存器无特殊范围限制
     }
@@ -80,7 +169,8 @@ static bool _process_special_regs(uint16_t start_addr, uint16_t reg_count, const
                 uint16_t utc_low = (write_data[(REG_UTC_TIMESTAMP_LOW - start_addr) * 2] << 8) |
                                    write_data[(REG_UTC_TIMESTAMP_LOW - start_addr) * 2 + 1];
                 uint32_t utc_full = ((uint32_t) utc_high << 16) | utc_low;
-                if (RTC_SetUTC(utc_full) != 0) return false; // 硬件写入失败
+                // 同步时间：记录偏差用于振荡器修正，异步写入不等待备份域
+                if (RTC_SyncUTC(utc_full) != HAL_OK) return false;
                 g_registers[REG_UTC_TIMESTAMP_HIGH] = utc_high;
                 g_registers[REG_UTC_TIMESTAMP_LOW] = utc_low;
                 break;
@@ -111,17 +201,10 @@ static bool _process_special_regs(uint16_t start_addr, uint16_t reg_count, const
 
             // 情况4：执行快捷键（值=1/2，触发对应动作）
             case REG_EXECUTE_SHORTCUT:
-                if (write_val == 1)
+                if (write_val == 1 || write_val == 2)
                 {
-                    // 执行快捷键1：使用预设的快捷键1配置
-                    // g_registers[REG_HEATING_STATUS] = 1;
-                    // g_registers[REG_HEATING_LEVEL] = g_registers[REG_SHORTCUT_KEY1];
-                }
-                else if (write_val == 2)
-                {
-                    // 执行快捷键2：使用预设的快捷键2配置
-                    // g_registers[REG_HEATING_STATUS] = 1;
-                    // g_registers[REG_HEATING_LEVEL] = g_registers[REG_SHORTCUT_KEY2];
+                    // 执行快捷键对应的加热曲线（由REG_SHORTCUT_KEY1/2配置）
+                    heat_run_shortcut((uint8_t) write_val);
                 }
                 else
                 {
@@ -160,8 +243,12 @@ void vModbusProcessTask(void *pvParameters)
 
     for (;;)
     {
-        // 从队列阻塞接收Modbus帧（无数据时挂起任务，不占用CPU）
-        if (xQueueReceive(xQueue_Modbus, modbus_rx_frame, portMAX_DELAY) != pdTRUE) continue;
+        // UTC同步挂起的RTC计数器写入通常由秒中断完成；秒中断未运行时由本任务轮询推进直到写入完成
+        RTC_WriteService();
+        TickType_t wait = (RTC_GetWriteState() == RTC_WRITE_IDLE) ? portMAX_DELAY : pdMS_TO_TICKS(RTC_WRITE_POLL_MS);
+
+        // 从队列阻塞接收Modbus帧（无数据且无挂起写入时挂起任务，不占用CPU）
+        if (xQueueReceive(xQueue_Modbus, modbus_rx_frame, wait) != pdTRUE) continue;
 
         // 解析帧头核心字段
         uint8_t        slave_addr = modbus_rx_frame[0];                           // 从站地址
@@ -220,8 +307,8 @@ void vModbusProcessTask(void *pvParameters)
                 // 填充寄存器数据（大端序：高字节在前）
                 for (uint16_t i = 0; i < reg_count; i++)
                 {
-                    uint16_t reg_val = _register_get_value((RegisterID) (reg_addr + i));
-                    if (reg_val == 0xFFFF) // 非法值（如越权读）
+                    uint16_t reg_val;
+                    if (!_register_get_value((RegisterID) (reg_addr + i), &reg_val)) // 非法读（如越权读）
                     {
                         modbus_tx_frame[1] |= 0x80;
                         modbus_tx_frame[2] = MODBUS_EXCEPTION_ILLEGAL_VAL;
@@ -17,18 +17,36 @@ extern "C"
 // 寄存器定义（明确读写属性）
 typedef enum
 {
-    REG_POWER_SWITCH = 0,   // 关机（只写）
-    REG_UTC_TIMESTAMP_HIGH, // UTC时间戳（高位，只写）
-    REG_UTC_TIMESTAMP_LOW,  // UTC时间戳（低位，只写）
-    REG_ALARM_SET_HIGH,     // 闹钟（高位，只写）
-    REG_ALARM_SET_LOW,      // 闹钟（低位，只写）
-    REG_DELETE_ALARM,       // 删除闹钟（只写）
-    REG_EXECUTE_SHORTCUT,   // 执行快捷键（只写）
-    REG_HEATING_STATUS,     // 热敷工作状态（读写）
-    REG_HEATING_LEVEL,      // 热敷档位（读写，1-5档）
-    REG_HEATING_TIMER,      // 热敷定时（读写，0-120分钟）
-    REG_SHORTCUT_KEY1,      // 快捷键1配置（读写）
-    REG_SHORTCUT_KEY2,      // 快捷键2配置（读写）
+    REG_POWER_SWITCH = 0,       // 关机（只写）
+    REG_UTC_TIMESTAMP_HIGH,     // UTC时间戳（高位，只写）
+    REG_UTC_TIMESTAMP_LOW,      // UTC时间戳（低位，只写）
+    REG_ALARM_SET_HIGH,         // 闹钟（高位，只写）
+    REG_ALARM_SET_LOW,          // 闹钟（低位，只写）
+    REG_DELETE_ALARM,           // 删除闹钟（只写）
+    REG_EXECUTE_SHORTCUT,       // 执行快捷键（只写）
+    REG_HEATING_STATUS,         // 热敷工作状态（读写）
+    REG_HEATING_LEVEL,          // 热敷档位（读写，1-5档）
+    REG_HEATING_TIMER,          // 热敷定时（读写，0-120分钟）
+    REG_SHORTCUT_KEY1,          // 快捷键1配置（读写，加热曲线编号）
+    REG_SHORTCUT_KEY2,          // 快捷键2配置（读写，加热曲线编号）
+    REG_HEATING_AUTOTUNE,       // PID自整定（读写，1=启动，0=取消）
+    REG_HEATING_PROFILE,        // 加热曲线（读写，0=取消，1~N=执行对应曲线）
+    REG_STAT_SESSION_ENERGY,    // 本次能耗（只读，0.01Wh）
+    REG_STAT_SESSION_MEAN_DUTY, // 本次平均占空比（只读，0.1%）
+    REG_STAT_SESSION_PEAK_DUTY, // 本次峰值占空比（只读，0.1%）
+    REG_STAT_SESSION_AT_TARGET, // 本次处于目标温度时间（只读，秒）
+    REG_STAT_SESSION_TO_TARGET, // 本次升温用时（只读，秒，0=未到达）
+    REG_STAT_TOTAL_SESSIONS,    // 累计加热次数（只读）
+    REG_STAT_TOTAL_ENERGY_HIGH, // 累计能耗（只读，0.01Wh，高位）
+    REG_STAT_TOTAL_ENERGY_LOW,  // 累计能耗（只读，0.01Wh，低位）
+    REG_STAT_TOTAL_RUN_TIME,    // 累计加热时间（只读，0.1小时）
+    REG_STAT_TOTAL_AT_TARGET,   // 累计处于目标温度时间（只读，0.1小时）
+    REG_STAT_AVG_TO_TARGET,     // 平均升温用时（只读，秒）
+    REG_STAT_MAX_TO_TARGET,     // 最长升温用时（只读，秒）
+    REG_HEATING_FAULT,          // 加热故障（读写，0=无，1=超温；写0清除）
+    REG_NTC_CAL_POINT1,         // NTC校准第一点（读写，写入参考温度0.1℃即采集）
+    REG_NTC_CAL_POINT2,         // NTC校准第二点（读写，写入参考温度0.1℃即采集并保存）
+    REG_NTC_CAL_STATE,          // NTC校准状态（读写，0=未校准，1=待第二点，2=已校准，3=失败；写0清除）
     REG_COUNT,
 } RegisterID;
 /*----------------------------------variable----------------------------------*/
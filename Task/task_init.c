@@ -30,6 +30,30 @@ void do_reg_change_actions(RegisterID reg, uint16_t value)
         case REG_HEATING_TIMER:
             heat_set_timer(value); // 设置定时（分钟）
             break;
+        case REG_HEATING_AUTOTUNE:
+            heat_set_autotune(value); // 启动/取消PID自整定
+            break;
+        case REG_SHORTCUT_KEY1:
+            heat_set_shortcut(1, value); // 快捷键1对应的加热曲线
+            break;
+        case REG_SHORTCUT_KEY2:
+            heat_set_shortcut(2, value); // 快捷键2对应的加热曲线
+            break;
+        case REG_HEATING_PROFILE:
+            heat_set_profile(value); // 执行/取消加热曲线
+            break;
+        case REG_HEATING_FAULT:
+            heat_clear_fault(); // 清除超温故障
+            break;
+        case REG_NTC_CAL_POINT1:
+            heat_ntc_calibrate(1, (q16_t) value * Q16_ONE / 10); // 参考温度0.1℃ -> Q16.16
+            break;
+        case REG_NTC_CAL_POINT2:
+            heat_ntc_calibrate(2, (q16_t) value * Q16_ONE / 10);
+            break;
+        case REG_NTC_CAL_STATE:
+            heat_ntc_calibration_clear(); // 清除校准，恢复标称参数
+            break;
         case REG_ALARM_SET_HIGH:
         case REG_ALARM_SET_LOW:
         case REG_DELETE_ALARM:
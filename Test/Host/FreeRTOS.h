@@ -0,0 +1,64 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*----------------------------------include-----------------------------------*/
+// 宿主机替身：协作式调度的FreeRTOS子集（见host_rtos.c），节拍为虚拟时钟，
+// 任务只在阻塞调用处切换，互斥锁因此无需真正加锁
+#include <assert.h>
+#include <stdint.h>
+/*-----------------------------------macro------------------------------------*/
+#define configTICK_RATE_HZ                  1000U
+#define configMAX_SYSCALL_INTERRUPT_PRIORITY 5
+#define configASSERT(x)                     assert(x)
+
+#define pdFALSE ((BaseType_t) 0)
+#define pdTRUE  ((BaseType_t) 1)
+#define pdFAIL  pdFALSE
+#define pdPASS  pdTRUE
+
+#define portMAX_DELAY              ((TickType_t) 0xFFFFFFFFU)
+#define portTICK_PERIOD_MS         ((TickType_t) 1000U / configTICK_RATE_HZ)
+#define portYIELD_FROM_ISR(x)      ((void) (x))
+#define pdMS_TO_TICKS(ms)          ((TickType_t) (((TickType_t) (ms) * (TickType_t) configTICK_RATE_HZ) / 1000U))
+#define taskENTER_CRITICAL()       ((void) 0)
+#define taskEXIT_CRITICAL()        ((void) 0)
+/*----------------------------------typedef-----------------------------------*/
+typedef uint32_t TickType_t;
+typedef long     BaseType_t;
+typedef unsigned UBaseType_t;
+
+typedef struct HostTask  *TaskHandle_t;
+typedef struct HostQueue *QueueHandle_t;
+typedef void (*TaskFunction_t)(void *);
+/*----------------------------------variable----------------------------------*/
+
+/*-------------------------------------os-------------------------------------*/
+
+/*----------------------------------function----------------------------------*/
+/**
+ * @brief 运行调度器直到虚拟时钟前进ticks个节拍（无就绪任务时直接跳到下一个唤醒时刻）
+ */
+void host_rtos_run(uint64_t ticks);
+
+/**
+ * @brief 注册周期性"中断"：虚拟时钟每经过period个节拍在调度器上下文中调用一次
+ * @return 0: 成功；-1: 数量已满
+ */
+int host_rtos_periodic(uint32_t period, void (*handler)(void));
+
+/**
+ * @brief 当前虚拟时间（64位，不回绕）
+ */
+uint64_t host_rtos_now(void);
+/*------------------------------------test------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_FREERTOS_H */
@@ -0,0 +1,46 @@
+/**
+ * @file host_flash.c
+ * @brief 宿主机Flash记录存储替身：每页只保留最近一条记录，语义与flash_store.c一致
+ */
+#include "flash_store.h"
+
+#include <string.h>
+
+#define HOST_FLASH_PAGES 2
+
+typedef struct
+{
+    uint32_t page;
+    uint16_t len; // 0表示无记录
+    uint8_t  data[FLASH_STORE_SIZE];
+} HostFlashPage;
+
+static HostFlashPage host_flash[HOST_FLASH_PAGES] = {{FLASH_STORE_STATS_PAGE, 0, {0}}, {FLASH_STORE_CAL_PAGE, 0, {0}}};
+
+static HostFlashPage *host_flash_page(uint32_t page)
+{
+    for (uint8_t i = 0; i < HOST_FLASH_PAGES; i++)
+    {
+        if (host_flash[i].page == page) return &host_flash[i];
+    }
+    return NULL;
+}
+
+HAL_StatusTypeDef flash_store_read(uint32_t page, void *data, uint16_t len)
+{
+    HostFlashPage *p = host_flash_page(page);
+
+    if (p == NULL || p->len == 0 || p->len != len) return HAL_ERROR;
+    memcpy(data, p->data, len);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef flash_store_write(uint32_t page, const void *data, uint16_t len)
+{
+    HostFlashPage *p = host_flash_page(page);
+
+    if (p == NULL || len == 0 || len > FLASH_STORE_SIZE) return HAL_ERROR;
+    memcpy(p->data, data, len);
+    p->len = len;
+    return HAL_OK;
+}
@@ -0,0 +1,245 @@
+/**
+ * @file host_hal.c
+ * @brief 宿主机HAL替身：外设寄存器实例与HAL函数的最小实现
+ *
+ * 寄存器保存在内存中，HAL配置函数只记录参数。需要硬件主动产生的行为
+ * （RTC同步标志、ADC DMA完成、模拟看门狗）由仿真程序通过host_xxx接口触发，
+ * 中断类事件置位标志后经固件的中断服务函数（Core/Src/stm32f1xx_it.c）分发。
+ */
+#include "main.h"
+#include "adc.h"
+#include "tim.h"
+#include "rtc.h"
+#include "stm32f1xx_it.h"
+
+#include "FreeRTOS.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+RTC_TypeDef         host_rtc;
+BKP_TypeDef         host_bkp;
+RCC_TypeDef         host_rcc;
+ADC_TypeDef         host_adc1;
+TIM_TypeDef         host_tim1 = {.ARR = 63999}; // 64MHz计数、1kHz PWM
+TIM_TypeDef         host_tim3;
+DMA_TypeDef         host_dma1;
+DMA_Channel_TypeDef host_dma1_channel1;
+GPIO_TypeDef        host_gpioa;
+GPIO_TypeDef        host_gpiob;
+DWT_Type            host_dwt;
+CoreDebug_Type      host_core_debug;
+uint32_t            SystemCoreClock = 64000000U;
+
+DMA_HandleTypeDef  hdma_adc1 = {.Instance = DMA1_Channel1, .Parent = &hadc1};
+ADC_HandleTypeDef  hadc1 = {.Instance = ADC1, .DMA_Handle = &hdma_adc1};
+TIM_HandleTypeDef  htim1 = {.Instance = TIM1};
+TIM_HandleTypeDef  htim2;
+TIM_HandleTypeDef  htim3 = {.Instance = TIM3};
+TIM_HandleTypeDef  htim4;
+UART_HandleTypeDef huart3;
+DMA_HandleTypeDef  hdma_usart3_rx;
+DMA_HandleTypeDef  hdma_usart3_tx;
+
+static uint16_t *host_adc_dma = NULL;
+static uint32_t  host_adc_dma_length = 0;
+
+void Error_Handler(void)
+{
+    fprintf(stderr, "Error_Handler\n");
+    abort();
+}
+
+// 每次查询时钟时视为经过了若干RTCCLK周期：同步/写完成标志置位
+uint32_t HAL_GetTick(void)
+{
+    SET_BIT(RTC->CRL, RTC_CRL_RSF | RTC_CRL_RTOFF);
+    return (uint32_t) host_rtos_now();
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub)
+{
+    (void) irq;
+    (void) preempt;
+    (void) sub;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type irq)
+{
+    (void) irq;
+}
+
+void HAL_PWR_EnableBkUpAccess(void)
+{
+    SET_BIT(RTC->CRL, RTC_CRL_RTOFF);
+}
+
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc, uint32_t reg)
+{
+    (void) hrtc;
+    return (reg < HOST_BKP_NUM) ? BKP->DR[reg] & 0xFFFFU : 0;
+}
+
+void HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t reg, uint32_t data)
+{
+    (void) hrtc;
+    if (reg < HOST_BKP_NUM) BKP->DR[reg] = data & 0xFFFFU;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *port, GPIO_InitTypeDef *init)
+{
+    (void) port;
+    (void) init;
+}
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc)
+{
+    (void) hadc;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, ADC_ChannelConfTypeDef *config)
+{
+    (void) hadc;
+    (void) config;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_AnalogWDGConfig(ADC_HandleTypeDef *hadc, ADC_AnalogWDGConfTypeDef *config)
+{
+    hadc->Instance->HTR = config->HighThreshold;
+    hadc->Instance->LTR = config->LowThreshold;
+    if (config->ITMode == ENABLE) __HAL_ADC_ENABLE_IT(hadc, ADC_IT_AWD);
+    return HAL_OK;
+}
+
+static void host_adc_dma_half_cplt(DMA_HandleTypeDef *hdma)
+{
+    HAL_ADC_ConvHalfCpltCallback((ADC_HandleTypeDef *) hdma->Parent);
+}
+
+static void host_adc_dma_cplt(DMA_HandleTypeDef *hdma)
+{
+    HAL_ADC_ConvCpltCallback((ADC_HandleTypeDef *) hdma->Parent);
+}
+
+// 与HAL一致：登记DMA回调并使能半传输/传输完成中断
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *data, uint32_t length)
+{
+    hadc->DMA_Handle->XferHalfCpltCallback = host_adc_dma_half_cplt;
+    hadc->DMA_Handle->XferCpltCallback = host_adc_dma_cplt;
+    SET_BIT(hadc->DMA_Handle->Instance->CCR, DMA_IT_HT | DMA_IT_TC);
+    host_adc_dma = (uint16_t *) data; // 半字传输
+    host_adc_dma_length = length;
+    return HAL_OK;
+}
+
+// 仅模拟DMA1通道1：标志置位且对应中断使能时清除标志并调用回调
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+    uint32_t ccr = hdma->Instance->CCR;
+
+    if ((DMA1->ISR & DMA_ISR_HTIF1) && (ccr & DMA_IT_HT))
+    {
+        CLEAR_BIT(DMA1->ISR, DMA_ISR_HTIF1);
+        if (hdma->XferHalfCpltCallback != NULL) hdma->XferHalfCpltCallback(hdma);
+    }
+    else if ((DMA1->ISR & DMA_ISR_TCIF1) && (ccr & DMA_IT_TC))
+    {
+        CLEAR_BIT(DMA1->ISR, DMA_ISR_TCIF1);
+        if (hdma->XferCpltCallback != NULL) hdma->XferCpltCallback(hdma);
+    }
+}
+
+void HAL_ADC_IRQHandler(ADC_HandleTypeDef *hadc)
+{
+    if ((hadc->Instance->SR & ADC_SR_AWD) && (hadc->Instance->CR1 & ADC_CR1_AWDIE))
+    {
+        HAL_ADC_LevelOutOfWindowCallback(hadc);
+        CLEAR_BIT(hadc->Instance->SR, ADC_SR_AWD);
+    }
+}
+
+__attribute__((weak)) void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    (void) hadc;
+}
+
+__attribute__((weak)) void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    (void) hadc;
+}
+
+__attribute__((weak)) void HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc)
+{
+    (void) hadc;
+}
+
+uint16_t *host_adc_dma_buffer(uint32_t *length)
+{
+    if (length != NULL) *length = host_adc_dma_length;
+    return host_adc_dma;
+}
+
+void host_adc_dma_complete(uint8_t half)
+{
+    uint32_t flag = half ? DMA_ISR_HTIF1 : DMA_ISR_TCIF1;
+    uint32_t it = half ? DMA_IT_HT : DMA_IT_TC;
+
+    SET_BIT(DMA1->ISR, flag);
+    DMA1_Channel1_IRQHandler();
+    if ((DMA1->ISR & flag) && (DMA1_Channel1->CCR & it))
+    {
+        fprintf(stderr, "DMA1_Channel1: interrupt flag not cleared (IRQ would re-enter)\n");
+        abort();
+    }
+}
+
+void host_adc_watchdog(uint16_t code)
+{
+    if (code <= ADC1->HTR && code >= ADC1->LTR) return;
+
+    SET_BIT(ADC1->SR, ADC_SR_AWD);
+    if (ADC1->CR1 & ADC_CR1_AWDIE) ADC1_2_IRQHandler();
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+    (void) htim;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *config,
+                                            uint32_t channel)
+{
+    __HAL_TIM_SET_COMPARE(htim, channel, config->Pulse);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t channel)
+{
+    (void) htim;
+    (void) channel;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Stop(TIM_HandleTypeDef *htim, uint32_t channel)
+{
+    __HAL_TIM_SET_COMPARE(htim, channel, 0);
+    return HAL_OK;
+}
+
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
+{
+    (void) htim;
+}
+
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
+{
+    (void) huart;
+}
+
+// 未链接rtc.c的仿真程序使用的空实现
+__attribute__((weak)) void RTC_SecondIRQHandler(void)
+{
+}
@@ -0,0 +1,243 @@
+/**
+ * @file host_rtos.c
+ * @brief 宿主机协作式FreeRTOS替身
+ *
+ * 每个任务运行在独立的ucontext栈上，只在阻塞调用（队列接收、任务通知、延时）处
+ * 让出CPU。调度器总是运行优先级最高的就绪任务；没有就绪任务时虚拟时钟直接跳到
+ * 最近的唤醒时刻或周期性中断时刻，因此空闲时间不消耗实际运行时间。
+ * 虚拟时钟为64位不回绕，xTaskGetTickCount截断为32位，与目标板一样会回绕。
+ */
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+#define HOST_TASK_MAX      8
+#define HOST_TASK_STACK    (256 * 1024)
+#define HOST_PERIODIC_MAX  4
+#define HOST_WAKE_NEVER    UINT64_MAX
+
+struct HostQueue
+{
+    uint8_t    *items;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head;
+    UBaseType_t count;
+};
+
+struct HostTask
+{
+    ucontext_t        context;
+    TaskFunction_t    code;
+    void             *param;
+    UBaseType_t       priority;
+    uint64_t          wake;        // 超时唤醒时刻
+    struct HostQueue *wait_queue;  // 等待的队列（非空即就绪）
+    uint8_t           wait_notify; // 是否等待任务通知
+    uint8_t           blocked;
+    uint32_t          notify;
+};
+
+typedef struct
+{
+    uint32_t period;
+    uint64_t next;
+    void (*handler)(void);
+} HostPeriodic;
+
+static struct HostTask  host_tasks[HOST_TASK_MAX];
+static uint8_t          host_task_num = 0;
+static struct HostTask *host_current = NULL;
+static ucontext_t       host_scheduler;
+static uint64_t         host_now = 0;
+static HostPeriodic     host_periodic[HOST_PERIODIC_MAX];
+static uint8_t          host_periodic_num = 0;
+
+static void host_task_entry(void)
+{
+    host_current->code(host_current->param);
+    abort(); // FreeRTOS任务不允许返回
+}
+
+// 阻塞当前任务直到被唤醒或超时
+static void host_block(TickType_t ticks)
+{
+    struct HostTask *task = host_current;
+    configASSERT(task != NULL); // 只能在任务中阻塞
+
+    task->wake = (ticks == portMAX_DELAY) ? HOST_WAKE_NEVER : host_now + ticks;
+    task->blocked = 1;
+    swapcontext(&task->context, &host_scheduler);
+}
+
+static uint8_t host_task_ready(const struct HostTask *task)
+{
+    if (!task->blocked) return 1;
+    if (task->wait_queue != NULL && task->wait_queue->count > 0) return 1;
+    if (task->wait_notify && task->notify > 0) return 1;
+    return host_now >= task->wake;
+}
+
+uint64_t host_rtos_now(void)
+{
+    return host_now;
+}
+
+int host_rtos_periodic(uint32_t period, void (*handler)(void))
+{
+    if (host_periodic_num >= HOST_PERIODIC_MAX || period == 0) return -1;
+
+    host_periodic[host_periodic_num].period = period;
+    host_periodic[host_periodic_num].next = host_now + period;
+    host_periodic[host_periodic_num].handler = handler;
+    host_periodic_num++;
+    return 0;
+}
+
+void host_rtos_run(uint64_t ticks)
+{
+    uint64_t end = host_now + ticks;
+
+    for (;;)
+    {
+        // 运行优先级最高的就绪任务，直到它再次阻塞
+        struct HostTask *next = NULL;
+        for (uint8_t i = 0; i < host_task_num; i++)
+        {
+            if (host_task_ready(&host_tasks[i]) && (next == NULL || host_tasks[i].priority > next->priority))
+            {
+                next = &host_tasks[i];
+            }
+        }
+        if (next != NULL)
+        {
+            next->blocked = 0;
+            host_current = next;
+            swapcontext(&host_scheduler, &next->context);
+            host_current = NULL;
+            continue;
+        }
+
+        // 全部阻塞：虚拟时钟跳到最近的唤醒或中断时刻
+        uint64_t event = end;
+        for (uint8_t i = 0; i < host_task_num; i++)
+        {
+            if (host_tasks[i].wake < event) event = host_tasks[i].wake;
+        }
+        for (uint8_t i = 0; i < host_periodic_num; i++)
+        {
+            if (host_periodic[i].next < event) event = host_periodic[i].next;
+        }
+        if (event >= end && host_now >= end) return;
+
+        host_now = (event > end) ? end : event;
+        for (uint8_t i = 0; i < host_periodic_num; i++)
+        {
+            if (host_periodic[i].next <= host_now)
+            {
+                host_periodic[i].next += host_periodic[i].period;
+                host_periodic[i].handler();
+            }
+        }
+    }
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint16_t stack_depth, void *param, UBaseType_t priority,
+                       TaskHandle_t *handle)
+{
+    (void) name;
+    (void) stack_depth;
+    if (host_task_num >= HOST_TASK_MAX) return pdFAIL;
+
+    struct HostTask *task = &host_tasks[host_task_num++];
+    memset(task, 0, sizeof(*task));
+    task->code = code;
+    task->param = param;
+    task->priority = priority;
+    task->wake = HOST_WAKE_NEVER;
+
+    getcontext(&task->context);
+    task->context.uc_stack.ss_sp = malloc(HOST_TASK_STACK);
+    task->context.uc_stack.ss_size = HOST_TASK_STACK;
+    task->context.uc_link = NULL;
+    configASSERT(task->context.uc_stack.ss_sp != NULL);
+    makecontext(&task->context, host_task_entry, 0);
+
+    if (handle != NULL) *handle = task;
+    return pdPASS;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t) host_now;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    host_block(ticks);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks)
+{
+    struct HostTask *task = host_current;
+
+    if (task->notify == 0 && ticks != 0)
+    {
+        task->wait_notify = 1;
+        host_block(ticks);
+        task->wait_notify = 0;
+    }
+
+    uint32_t value = task->notify;
+    if (value > 0) task->notify = clear_on_exit ? 0 : value - 1;
+    return value;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_woken)
+{
+    task->notify++;
+    if (higher_priority_woken != NULL) *higher_priority_woken = pdTRUE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    struct HostQueue *queue = calloc(1, sizeof(*queue));
+    if (queue == NULL) return NULL;
+
+    queue->length = length;
+    queue->item_size = item_size;
+    queue->items = calloc(length, item_size ? item_size : 1);
+    return queue;
+}
+
+// 协作式调度下队列满时不会有任务在发送期间取走数据，满即失败
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    (void) ticks;
+    if (queue->count >= queue->length) return pdFALSE;
+
+    UBaseType_t tail = (queue->head + queue->count) % queue->length;
+    memcpy(queue->items + tail * queue->item_size, item, queue->item_size);
+    queue->count++;
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticks)
+{
+    if (queue->count == 0 && ticks != 0)
+    {
+        host_current->wait_queue = queue;
+        host_block(ticks);
+        host_current->wait_queue = NULL;
+    }
+    if (queue->count == 0) return pdFALSE;
+
+    memcpy(buffer, queue->items + queue->head * queue->item_size, queue->item_size);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    return pdTRUE;
+}
@@ -0,0 +1,24 @@
+#ifndef HOST_SEMPHR_H
+#define HOST_SEMPHR_H
+
+#include "queue.h"
+
+// 协作式调度下持锁期间不会切换任务，互斥锁只需返回有效句柄
+typedef QueueHandle_t SemaphoreHandle_t;
+
+#define xSemaphoreCreateMutex() xQueueCreate(1, 0)
+
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticks)
+{
+    (void) mutex;
+    (void) ticks;
+    return pdTRUE;
+}
+
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex)
+{
+    (void) mutex;
+    return pdTRUE;
+}
+
+#endif /* HOST_SEMPHR_H */
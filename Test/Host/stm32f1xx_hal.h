@@ -0,0 +1,357 @@
+#ifndef HOST_STM32F1XX_HAL_H
+#define HOST_STM32F1XX_HAL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*----------------------------------include-----------------------------------*/
+// 宿主机替身：只提供固件源码实际用到的HAL类型、寄存器和宏，外设寄存器为内存中的普通结构体，
+// 由测试程序直接读写以模拟硬件行为（中断标志、ADC读数、PWM比较值等）
+#include <stddef.h>
+#include <stdint.h>
+/*-----------------------------------macro------------------------------------*/
+#define __IO volatile
+
+#define SET_BIT(REG, BIT)                   ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)                 ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)                  ((REG) & (BIT))
+#define WRITE_REG(REG, VAL)                 ((REG) = (VAL))
+#define READ_REG(REG)                       ((REG))
+#define MODIFY_REG(REG, CLEARMASK, SETMASK) WRITE_REG((REG), (((READ_REG(REG)) & (~(CLEARMASK))) | (SETMASK)))
+
+#define ENABLE  1U
+#define DISABLE 0U
+
+// RTC
+#define RTC_CRL_SECF     0x0001U
+#define RTC_CRL_RSF      0x0008U
+#define RTC_CRL_CNF      0x0010U
+#define RTC_CRL_RTOFF    0x0020U
+#define RTC_CRH_SECIE    0x0001U
+#define RTC_DIVH_RTC_DIV 0x000FU
+
+#define RTC_BKP_DR1  1U
+#define RTC_BKP_DR2  2U
+#define RTC_BKP_DR3  3U
+#define RTC_BKP_DR4  4U
+#define RTC_BKP_DR5  5U
+#define RTC_BKP_DR6  6U
+#define RTC_BKP_DR7  7U
+#define RTC_BKP_DR8  8U
+#define RTC_BKP_DR9  9U
+#define RTC_BKP_DR10 10U
+#define HOST_BKP_NUM 43
+
+#define BKP_RTCCR_CAL 0x007FU
+
+// RCC
+#define RCC_BDCR_LSEON      0x0001U
+#define RCC_BDCR_LSERDY     0x0002U
+#define RCC_BDCR_RTCSEL     0x0300U
+#define RCC_BDCR_RTCSEL_LSE 0x0100U
+#define RCC_BDCR_RTCSEL_LSI 0x0200U
+#define RCC_BDCR_RTCEN      0x8000U
+#define RCC_CSR_LSION       0x0001U
+#define RCC_CSR_LSIRDY      0x0002U
+#define RCC_LSE_OFF         0U
+#define RCC_LSE_ON          RCC_BDCR_LSEON
+#define RCC_FLAG_LSERDY     RCC_BDCR_LSERDY
+
+// 起振在宿主机上立即完成
+#define __HAL_RCC_PWR_CLK_ENABLE() ((void) 0)
+#define __HAL_RCC_BKP_CLK_ENABLE() ((void) 0)
+#define __HAL_RCC_LSE_CONFIG(state)                                                                                    \
+    ((state) == RCC_LSE_ON ? SET_BIT(RCC->BDCR, RCC_BDCR_LSEON | RCC_BDCR_LSERDY)                                      \
+                           : CLEAR_BIT(RCC->BDCR, RCC_BDCR_LSEON | RCC_BDCR_LSERDY))
+#define __HAL_RCC_LSI_ENABLE()  SET_BIT(RCC->CSR, RCC_CSR_LSION | RCC_CSR_LSIRDY)
+#define __HAL_RCC_GET_FLAG(flg) ((RCC->BDCR & (flg)) != 0U)
+
+// GPIO
+#define GPIO_PIN_0  0x0001U
+#define GPIO_PIN_1  0x0002U
+#define GPIO_PIN_2  0x0004U
+#define GPIO_PIN_3  0x0008U
+#define GPIO_PIN_4  0x0010U
+#define GPIO_PIN_5  0x0020U
+#define GPIO_PIN_6  0x0040U
+#define GPIO_PIN_7  0x0080U
+#define GPIO_PIN_8  0x0100U
+#define GPIO_PIN_9  0x0200U
+#define GPIO_PIN_10 0x0400U
+#define GPIO_PIN_11 0x0800U
+#define GPIO_PIN_12 0x1000U
+#define GPIO_PIN_13 0x2000U
+#define GPIO_PIN_14 0x4000U
+#define GPIO_PIN_15 0x8000U
+
+#define GPIO_MODE_ANALOG      0x00000003U
+#define GPIO_MODE_AF_PP       0x00000002U
+#define GPIO_PULLDOWN         0x00000002U
+#define GPIO_SPEED_FREQ_HIGH  0x00000003U
+
+// TIM
+#define TIM_CHANNEL_1          0x00000000U
+#define TIM_CHANNEL_2          0x00000004U
+#define TIM_CHANNEL_3          0x00000008U
+#define TIM_CHANNEL_4          0x0000000CU
+#define TIM_OCMODE_PWM1        0x00000060U
+#define TIM_OCPOLARITY_HIGH    0x00000000U
+#define TIM_OCFAST_DISABLE     0x00000000U
+#define TIM_OCIDLESTATE_RESET  0x00000000U
+#define TIM_OCNIDLESTATE_RESET 0x00000000U
+
+#define __HAL_TIM_SET_COMPARE(h, ch, v)  (*(&((h)->Instance->CCR1) + ((ch) >> 2U)) = (v))
+#define __HAL_TIM_GET_COMPARE(h, ch)     (*(&((h)->Instance->CCR1) + ((ch) >> 2U)))
+#define __HAL_TIM_GET_AUTORELOAD(h)      ((h)->Instance->ARR)
+#define __HAL_TIM_SET_AUTORELOAD(h, arr) ((h)->Instance->ARR = (arr))
+
+// ADC
+#define ADC_CR1_AWDIE                0x00000040U
+#define ADC_SR_AWD                   0x00000001U
+#define ADC_IT_AWD                   ADC_CR1_AWDIE
+#define ADC_FLAG_AWD                 ADC_SR_AWD
+#define ADC_SCAN_ENABLE              0x00000100U
+#define ADC_EXTERNALTRIGCONV_T1_CC2  0x00020000U
+#define ADC_EXTERNALTRIGCONV_T3_TRGO 0x00080000U
+#define ADC_SAMPLETIME_239CYCLES_5   0x00000007U
+#define ADC_REGULAR_RANK_1           0x00000001U
+#define ADC_ANALOGWATCHDOG_ALL_REG   0x00800000U
+#define ADC_CHANNEL_4                4U
+#define ADC_CHANNEL_5                5U
+#define ADC_CHANNEL_6                6U
+#define ADC_CHANNEL_VREFINT          17U
+
+#define __HAL_ADC_ENABLE_IT(h, it)    SET_BIT((h)->Instance->CR1, (it))
+#define __HAL_ADC_DISABLE_IT(h, it)   CLEAR_BIT((h)->Instance->CR1, (it))
+#define __HAL_ADC_CLEAR_FLAG(h, flag) CLEAR_BIT((h)->Instance->SR, (flag))
+
+// DMA（仅模拟ADC使用的DMA1通道1）
+#define DMA_ISR_TCIF1 0x00000002U
+#define DMA_ISR_HTIF1 0x00000004U
+#define DMA_IT_TC     0x00000002U
+#define DMA_IT_HT     0x00000004U
+
+// 中断控制：宿主机上单线程执行，全部为空操作
+#define __disable_irq()        ((void) 0)
+#define __enable_irq()         ((void) 0)
+#define __get_PRIMASK()        0U
+#define __set_PRIMASK(primask) ((void) (primask))
+#define __DMB()                ((void) 0)
+#define NVIC_EnableIRQ(irq)    ((void) (irq))
+#define NVIC_DisableIRQ(irq)   ((void) (irq))
+
+// DWT周期计数器（由host_hal按虚拟时钟推进）
+#define CoreDebug_DEMCR_TRCENA_Msk 0x01000000U
+#define DWT_CTRL_CYCCNTENA_Msk     0x00000001U
+
+// 外设实例
+#define RTC           (&host_rtc)
+#define BKP           (&host_bkp)
+#define RCC           (&host_rcc)
+#define ADC1          (&host_adc1)
+#define TIM1          (&host_tim1)
+#define TIM3          (&host_tim3)
+#define DMA1          (&host_dma1)
+#define DMA1_Channel1 (&host_dma1_channel1)
+#define GPIOA         (&host_gpioa)
+#define GPIOB         (&host_gpiob)
+#define DWT           (&host_dwt)
+#define CoreDebug     (&host_core_debug)
+/*----------------------------------typedef-----------------------------------*/
+typedef enum
+{
+    HAL_OK = 0x00U,
+    HAL_ERROR = 0x01U,
+    HAL_BUSY = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+    RTC_IRQn = 3,
+    ADC1_2_IRQn = 18,
+    TIM1_UP_IRQn = 25
+} IRQn_Type;
+
+typedef struct
+{
+    __IO uint32_t CRH, CRL, PRLH, PRLL, DIVH, DIVL, CNTH, CNTL, ALRH, ALRL;
+} RTC_TypeDef;
+
+typedef struct
+{
+    __IO uint32_t DR[HOST_BKP_NUM];
+    __IO uint32_t RTCCR;
+} BKP_TypeDef;
+
+typedef struct
+{
+    __IO uint32_t BDCR, CSR;
+} RCC_TypeDef;
+
+typedef struct
+{
+    __IO uint32_t SR, CR1, CR2, HTR, LTR;
+} ADC_TypeDef;
+
+typedef struct
+{
+    __IO uint32_t CR1, ARR, CCR1, CCR2, CCR3, CCR4;
+} TIM_TypeDef;
+
+typedef struct
+{
+    __IO uint32_t CRL, CRH, IDR, ODR, BSRR, BRR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+    __IO uint32_t ISR, IFCR;
+} DMA_TypeDef;
+
+typedef struct
+{
+    __IO uint32_t CCR, CNDTR, CPAR, CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+    __IO uint32_t CTRL, CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    RTC_TypeDef *Instance;
+} RTC_HandleTypeDef;
+
+typedef struct
+{
+    uint32_t ScanConvMode;
+    uint32_t NbrOfConversion;
+    uint32_t ExternalTrigConv;
+} ADC_InitTypeDef;
+
+typedef struct __DMA_HandleTypeDef
+{
+    DMA_Channel_TypeDef *Instance;
+    void                *Parent;
+    void (*XferCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+    void (*XferHalfCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+} DMA_HandleTypeDef;
+
+typedef struct
+{
+    ADC_TypeDef       *Instance;
+    ADC_InitTypeDef    Init;
+    DMA_HandleTypeDef *DMA_Handle;
+} ADC_HandleTypeDef;
+
+typedef struct
+{
+    uint32_t Channel;
+    uint32_t Rank;
+    uint32_t SamplingTime;
+} ADC_ChannelConfTypeDef;
+
+typedef struct
+{
+    uint32_t WatchdogMode;
+    uint32_t Channel;
+    uint32_t ITMode;
+    uint32_t HighThreshold;
+    uint32_t LowThreshold;
+} ADC_AnalogWDGConfTypeDef;
+
+typedef struct
+{
+    TIM_TypeDef *Instance;
+} TIM_HandleTypeDef;
+
+typedef struct
+{
+    void *Instance;
+} UART_HandleTypeDef;
+
+typedef struct
+{
+    uint32_t OCMode;
+    uint32_t Pulse;
+    uint32_t OCPolarity;
+    uint32_t OCNPolarity;
+    uint32_t OCFastMode;
+    uint32_t OCIdleState;
+    uint32_t OCNIdleState;
+} TIM_OC_InitTypeDef;
+
+typedef struct
+{
+    uint32_t Pin;
+    uint32_t Mode;
+    uint32_t Pull;
+    uint32_t Speed;
+} GPIO_InitTypeDef;
+/*----------------------------------variable----------------------------------*/
+extern RTC_TypeDef         host_rtc;
+extern BKP_TypeDef         host_bkp;
+extern RCC_TypeDef         host_rcc;
+extern ADC_TypeDef         host_adc1;
+extern TIM_TypeDef         host_tim1;
+extern TIM_TypeDef         host_tim3;
+extern DMA_TypeDef         host_dma1;
+extern DMA_Channel_TypeDef host_dma1_channel1;
+extern GPIO_TypeDef        host_gpioa;
+extern GPIO_TypeDef        host_gpiob;
+extern DWT_Type            host_dwt;
+extern CoreDebug_Type      host_core_debug;
+extern uint32_t            SystemCoreClock;
+/*-------------------------------------os-------------------------------------*/
+
+/*----------------------------------function----------------------------------*/
+uint32_t HAL_GetTick(void);
+void     HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub);
+void     HAL_NVIC_EnableIRQ(IRQn_Type irq);
+void     HAL_PWR_EnableBkUpAccess(void);
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc, uint32_t reg);
+void     HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t reg, uint32_t data);
+void     HAL_GPIO_Init(GPIO_TypeDef *port, GPIO_InitTypeDef *init);
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, ADC_ChannelConfTypeDef *config);
+HAL_StatusTypeDef HAL_ADC_AnalogWDGConfig(ADC_HandleTypeDef *hadc, ADC_AnalogWDGConfTypeDef *config);
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *data, uint32_t length);
+void              HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc);
+void              HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc);
+void              HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc);
+void              HAL_ADC_IRQHandler(ADC_HandleTypeDef *hadc);
+void              HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *config,
+                                            uint32_t channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Stop(TIM_HandleTypeDef *htim, uint32_t channel);
+void              HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim);
+void              HAL_UART_IRQHandler(UART_HandleTypeDef *huart);
+
+// 仿真接口：ADC DMA缓冲区（由HAL_ADC_Start_DMA登记）写满一半/全部时调用：置位DMA1通道1的
+// 半传输/传输完成标志并进入固件的DMA1_Channel1_IRQHandler；中断返回后标志未被清除时报错退出
+// （目标板上中断会无限重入）
+uint16_t *host_adc_dma_buffer(uint32_t *length);
+void      host_adc_dma_complete(uint8_t half);
+
+// 仿真接口：对一次扫描结果执行模拟看门狗比较（超过HTR且中断使能时经ADC1_2_IRQHandler进入回调）
+void host_adc_watchdog(uint16_t code);
+/*------------------------------------test------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STM32F1XX_HAL_H */
@@ -0,0 +1,7 @@
+#ifndef HOST_STM32F1XX_HAL_ADC_H
+#define HOST_STM32F1XX_HAL_ADC_H
+
+// 宿主机替身：寄存器与HAL定义统一在stm32f1xx_hal.h中
+#include "stm32f1xx_hal.h"
+
+#endif /* HOST_STM32F1XX_HAL_ADC_H */
@@ -0,0 +1,13 @@
+#ifndef HOST_TASK_H
+#define HOST_TASK_H
+
+#include "FreeRTOS.h"
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint16_t stack_depth, void *param, UBaseType_t priority,
+                       TaskHandle_t *handle);
+TickType_t xTaskGetTickCount(void);
+void       vTaskDelay(TickType_t ticks);
+uint32_t   ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
+void       vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_woken);
+
+#endif /* HOST_TASK_H */
@@ -0,0 +1,220 @@
+/**
+ * @file alarm_sim.c
+ * @brief 闹钟与加热定时的虚拟时钟仿真
+ *
+ * 在宿主机上运行真实的alarm.c、heat_task.c与rtc.c：RTC计数器和FreeRTOS节拍均为虚拟时钟，
+ * 每个虚拟秒置位SECF并调用RTC_SecondIRQHandler，闹钟任务由分钟边沿唤醒，加热任务
+ * 按自身的阻塞超时运行。所有任务阻塞时虚拟时钟直接跳到下一事件，数周设备时间只需数秒。
+ *
+ * 场景：工作日07:30（闹钟0）、周末22:00（闹钟1）重复，首个周三12:00单次（闹钟2）；
+ * 模拟App在每次加热停止后重新预设30分钟定时。仿真结束时核对触发次数和每次加热时长。
+ *
+ * 用法：alarm_sim [--weeks N] [--bench] [--quiet]
+ *   --bench  不打印事件，报告每墙钟秒仿真的设备天数
+ */
+#include "alarm.h"
+#include "heat_task.h"
+#include "rtc.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SIM_START_UTC      1748736000UL // 2025-06-01 00:00:00（星期日）
+#define SIM_HEAT_MINUTES   30           // 每次加热的预设定时
+#define SIM_DEFAULT_WEEKS  4
+#define SIM_BENCH_WEEKS    52
+#define SIM_APP_PERIOD_MS  1000
+#define SIM_NTC_AMBIENT    2048         // 25℃对应的ADC码（NTC与串联电阻同为10kΩ）
+#define SIM_ALARM_NUM      3
+
+typedef struct
+{
+    uint32_t alarm_fired[SIM_ALARM_NUM];
+    uint32_t heat_start;
+    uint32_t heat_stop;
+    uint32_t heat_bad_duration; // 加热时长不等于预设定时的次数
+    uint64_t heat_start_ms;
+} SimResult;
+
+static SimResult sim;
+static uint8_t   sim_verbose = 1;
+static uint8_t   sim_rearm = 1; // 加热已停止，需要重新预设定时
+
+static const char *const sim_weekday[7] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+
+static void sim_print_time(void)
+{
+    RTC_DateTimeTypeDef now;
+    RTC_GetDateTime(&now);
+    printf("[20%02u-%02u-%02u %02u:%02u:%02u %s] ", now.year, now.month, now.day, now.hour, now.minute, now.second,
+           sim_weekday[now.weekday]);
+}
+
+// 闹钟触发回调：记录次数
+static void sim_alarm_fired(const Alarm *alarm)
+{
+    if (alarm->id < SIM_ALARM_NUM) sim.alarm_fired[alarm->id]++;
+    if (!sim_verbose) return;
+
+    sim_print_time();
+    printf("alarm %u fired\n", alarm->id);
+}
+
+// 加热状态切换回调：记录启停并核对定时长度
+static void sim_heat_changed(HeatStatus old_status, HeatStatus new_status)
+{
+    uint64_t now_ms = host_rtos_now();
+
+    (void) old_status;
+    if (new_status == HEAT_RUNNING)
+    {
+        sim.heat_start++;
+        sim.heat_start_ms = now_ms;
+    }
+    else
+    {
+        uint64_t duration_ms = now_ms - sim.heat_start_ms;
+        uint64_t expect_ms = (uint64_t) SIM_HEAT_MINUTES * 60 * 1000;
+
+        // 定时在加热任务下一次唤醒时判断，允许滞后一个慢速控制周期
+        sim.heat_stop++;
+        if (duration_ms < expect_ms || duration_ms > expect_ms + 1000) sim.heat_bad_duration++;
+        sim_rearm = 1;
+    }
+    if (!sim_verbose) return;
+
+    sim_print_time();
+    if (new_status == HEAT_RUNNING) printf("heat RUNNING\n");
+    else printf("heat STOP after %.1f min\n", (now_ms - sim.heat_start_ms) / 60000.0);
+}
+
+// 模拟App：加热停止后重新预设定时（heat_set_status(HEAT_STOP)会清除定时）
+static void sim_app_task(void *arg)
+{
+    (void) arg;
+    for (;;)
+    {
+        if (sim_rearm)
+        {
+            sim_rearm = 0;
+            heat_set_timer(SIM_HEAT_MINUTES);
+        }
+        vTaskDelay(pdMS_TO_TICKS(SIM_APP_PERIOD_MS));
+    }
+}
+
+// 虚拟RTC秒中断：计数器加1并进入真实的秒中断处理
+static void sim_rtc_second(void)
+{
+    uint32_t counter = ((RTC->CNTH << 16) | RTC->CNTL) + 1;
+
+    RTC->CNTH = counter >> 16;
+    RTC->CNTL = counter & 0xFFFF;
+    SET_BIT(RTC->CRL, RTC_CRL_SECF);
+    RTC_SecondIRQHandler();
+}
+
+// 按Modbus寄存器格式设置闹钟
+static void sim_alarm_set(uint8_t id, uint8_t hour, uint8_t minute, AlarmRepeatMode repeat, uint8_t weekday_mask)
+{
+    uint16_t high = (uint16_t) (id << 11 | hour << 6 | minute);
+    uint16_t low = (uint16_t) (1U | repeat << 1 | weekday_mask << 2);
+
+    alarm_handle_modbus_write(REG_ALARM_SET_HIGH, high);
+    alarm_handle_modbus_write(REG_ALARM_SET_LOW, low);
+}
+
+// NTC读数固定为室温：加热任务照常测温和控制，但不影响定时逻辑
+static void sim_ntc_ambient(void)
+{
+    uint32_t  length;
+    uint16_t *buffer = host_adc_dma_buffer(&length);
+
+    for (uint32_t i = 0; i < length; i++) { buffer[i] = SIM_NTC_AMBIENT; }
+    host_adc_dma_complete(0);
+}
+
+static int sim_check(uint32_t weeks)
+{
+    uint32_t expect[SIM_ALARM_NUM] = {5 * weeks, 2 * weeks, 1};
+    uint32_t starts = expect[0] + expect[1] + expect[2];
+    int      failed = 0;
+
+    for (uint8_t i = 0; i < SIM_ALARM_NUM; i++)
+    {
+        if (sim.alarm_fired[i] != expect[i])
+        {
+            printf("FAIL: alarm %u fired %u times, expected %u\n", i, sim.alarm_fired[i], expect[i]);
+            failed = 1;
+        }
+    }
+    if (sim.heat_start != starts || sim.heat_stop != starts)
+    {
+        printf("FAIL: heat started %u / stopped %u times, expected %u\n", sim.heat_start, sim.heat_stop, starts);
+        failed = 1;
+    }
+    if (sim.heat_bad_duration != 0)
+    {
+        printf("FAIL: %u heat sessions did not last %u min\n", sim.heat_bad_duration, SIM_HEAT_MINUTES);
+        failed = 1;
+    }
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t weeks = SIM_DEFAULT_WEEKS;
+    uint8_t  bench = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--weeks") == 0 && i + 1 < argc) weeks = (uint32_t) atoi(argv[++i]);
+        else if (strcmp(argv[i], "--bench") == 0) bench = 1;
+        else if (strcmp(argv[i], "--quiet") == 0) sim_verbose = 0;
+        else
+        {
+            printf("usage: %s [--weeks N] [--bench] [--quiet]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (bench)
+    {
+        sim_verbose = 0;
+        if (weeks == SIM_DEFAULT_WEEKS) weeks = SIM_BENCH_WEEKS;
+    }
+
+    // 与固件启动顺序一致：RTC、加热任务、闹钟系统
+    RTC_Init();
+    RTC_SetUTC(SIM_START_UTC);
+    heat_task_init();
+    alarm_system_init();
+    sim_ntc_ambient();
+    xTaskCreate(sim_app_task, "sim_app", 256, NULL, 1, NULL);
+    host_rtos_periodic(configTICK_RATE_HZ, sim_rtc_second);
+
+    alarm_set_fire_hook(sim_alarm_fired);
+    heat_set_status_hook(sim_heat_changed);
+    sim_alarm_set(0, 7, 30, ALARM_REPEAT, ALARM_WEEKDAY_MON | ALARM_WEEKDAY_TUE | ALARM_WEEKDAY_WED |
+                                              ALARM_WEEKDAY_THU | ALARM_WEEKDAY_FRI);
+    sim_alarm_set(1, 22, 0, ALARM_REPEAT, ALARM_WEEKDAY_SAT | ALARM_WEEKDAY_SUN);
+    sim_alarm_set(2, 12, 0, ALARM_ONCE, ALARM_WEEKDAY_WED);
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    host_rtos_run((uint64_t) weeks * 7 * 86400 * configTICK_RATE_HZ);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    double wall_s = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    printf("simulated %u weeks: alarms %u/%u/%u, heat sessions %u\n", weeks, sim.alarm_fired[0], sim.alarm_fired[1],
+           sim.alarm_fired[2], sim.heat_stop);
+    if (bench) printf("benchmark: %.1f s wall, %.0f simulated days per wall second\n", wall_s, weeks * 7 / wall_s);
+
+    int failed = sim_check(weeks);
+    if (!failed) printf("PASS\n");
+    return failed;
+}
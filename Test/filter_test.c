@@ -0,0 +1,260 @@
+/**
+ * @file filter_test.c
+ * @brief 定点滤波级单元测试及逐级耗时基准
+ *
+ * 各滤波级分别与浮点/暴力参考实现逐样本比较：滑动中值对比窗口排序结果，一阶低通与
+ * 二阶节对比相同（已量化）系数下的双精度递推，变化率限幅与野值剔除检查逐样本行为。
+ * 另检查首个样本初始化状态、复位后重新初始化以及滤波链的级联顺序。
+ *
+ * 用法：filter_test [--bench]
+ */
+#include "filter.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TEST_CYCLES() __rdtsc()
+#else
+#define TEST_CYCLES() 0ULL
+#endif
+
+#define TEST_SAMPLES     20000
+#define TEST_IIR_TOL     0.002 // 一阶低通累计截断误差（℃）
+#define TEST_BIQUAD_TOL  0.01  // 二阶节累计截断误差（℃）
+#define TEST_BENCH_CALLS 2000000
+
+static int test_failed = 0;
+
+static void test_expect(const char *what, int ok)
+{
+    if (ok) return;
+    printf("FAIL: %s\n", what);
+    test_failed = 1;
+}
+
+// 测试输入：40℃附近的随机游走，叠加噪声和偶发尖峰
+static q16_t test_input(int k)
+{
+    static double walk = 40.0;
+
+    walk += (rand() % 201 - 100) * 0.001;
+    double x = walk + (rand() % 101 - 50) * 0.002;
+    if (k % 97 == 13) x += 20.0;
+    return q16_from_float((float) x);
+}
+
+static int test_compare_q16(const void *a, const void *b)
+{
+    q16_t x = *(const q16_t *) a, y = *(const q16_t *) b;
+    return (x > y) - (x < y);
+}
+
+static void test_median(void)
+{
+    static const uint8_t sizes[] = {1, 3, 5, 9};
+    FilterStage          s;
+
+    for (unsigned n = 0; n < sizeof(sizes); n++)
+    {
+        q16_t history[TEST_SAMPLES];
+        int   mismatches = 0;
+
+        filter_median_init(&s, sizes[n]);
+        for (int k = 0; k < TEST_SAMPLES; k++)
+        {
+            history[k] = test_input(k);
+            q16_t y = filter_stage_step(&s, history[k]);
+
+            // 参考：最近min(k+1, size)个样本排序后取第count/2个
+            q16_t window[FILTER_MEDIAN_MAX];
+            int   count = (k + 1 < sizes[n]) ? k + 1 : sizes[n];
+            memcpy(window, &history[k + 1 - count], count * sizeof(q16_t));
+            qsort(window, count, sizeof(q16_t), test_compare_q16);
+            if (y != window[count / 2]) mismatches++;
+        }
+        printf("median %u: %d mismatches\n", sizes[n], mismatches);
+        test_expect("median matches sorted window", mismatches == 0);
+    }
+
+    filter_median_init(&s, 20);
+    test_expect("median size clamped to FILTER_MEDIAN_MAX", s.median.size == FILTER_MEDIAN_MAX);
+}
+
+static void test_iir(void)
+{
+    FilterStage s;
+    double      worst = 0.0, y = 0.0;
+
+    filter_iir_init(&s, Q16_FROM_FLOAT(0.25f));
+    double alpha = Q16_TO_FLOAT(s.iir.alpha);
+    for (int k = 0; k < TEST_SAMPLES; k++)
+    {
+        q16_t x = test_input(k);
+        q16_t out = filter_stage_step(&s, x);
+
+        y = (k == 0) ? Q16_TO_FLOAT(x) : y + alpha * (Q16_TO_FLOAT(x) - y);
+        if (fabs(Q16_TO_FLOAT(out) - y) > worst) worst = fabs(Q16_TO_FLOAT(out) - y);
+    }
+    printf("iir: max error %.5f C\n", worst);
+    test_expect("iir tracks double reference", worst <= TEST_IIR_TOL);
+
+    filter_iir_init(&s, 0);
+    test_expect("iir alpha clamped above 0", s.iir.alpha > 0);
+}
+
+static void test_biquad(void)
+{
+    // 二阶巴特沃斯低通，截止频率为采样率的5%（RBJ公式，a0归一化）
+    double w0 = 2.0 * M_PI * 0.05, cw = cos(w0), alpha = sin(w0) / (2.0 * M_SQRT2);
+    double a0 = 1.0 + alpha;
+    q16_t  b[3] = {q16_from_float((float) ((1.0 - cw) / 2.0 / a0)), q16_from_float((float) ((1.0 - cw) / a0)),
+                   q16_from_float((float) ((1.0 - cw) / 2.0 / a0))};
+    q16_t  a[2] = {q16_from_float((float) (-2.0 * cw / a0)), q16_from_float((float) ((1.0 - alpha) / a0))};
+
+    FilterStage s;
+    double      x1 = 0, x2 = 0, y1 = 0, y2 = 0, worst = 0.0;
+
+    filter_biquad_init(&s, b, a);
+    for (int k = 0; k < TEST_SAMPLES; k++)
+    {
+        q16_t  x = test_input(k);
+        q16_t  out = filter_stage_step(&s, x);
+        double xd = Q16_TO_FLOAT(x), y;
+
+        if (k == 0) x1 = x2 = y1 = y2 = y = xd;
+        else
+        {
+            y = (b[0] * xd + b[1] * x1 + b[2] * x2 - a[0] * y1 - a[1] * y2) / Q16_ONE;
+            x2 = x1, x1 = xd, y2 = y1, y1 = y;
+        }
+        if (fabs(Q16_TO_FLOAT(out) - y) > worst) worst = fabs(Q16_TO_FLOAT(out) - y);
+    }
+    printf("biquad: max error %.5f C\n", worst);
+    test_expect("biquad tracks double reference", worst <= TEST_BIQUAD_TOL);
+
+    // 首个样本按直流稳态初始化：恒定输入不产生启动瞬态。量化系数的直流增益不严格为1，
+    // 输出向 增益×输入 过渡（巴特沃斯节欠阻尼，允许一倍过冲）
+    double dc_error = 2.0 * 55.0 * fabs((double) (b[0] + b[1] + b[2]) / (Q16_ONE + a[0] + a[1]) - 1.0);
+    int    settled = 1;
+    filter_stage_reset(&s);
+    for (int k = 0; k < 100; k++)
+    {
+        settled &= fabs(Q16_TO_FLOAT(filter_stage_step(&s, Q16_FROM_INT(55))) - 55.0) <= dc_error;
+    }
+    test_expect("biquad starts at steady state", settled);
+}
+
+static void test_rate_limit(void)
+{
+    FilterStage s;
+    q16_t       step = Q16_FROM_FLOAT(0.5f);
+
+    filter_rate_limit_init(&s, step);
+    test_expect("rate limit primes with first sample", filter_stage_step(&s, Q16_FROM_INT(20)) == Q16_FROM_INT(20));
+
+    // 阶跃到30℃：每样本上升0.5℃，20个样本后到达
+    int ok = 1;
+    for (int k = 1; k <= 25; k++)
+    {
+        q16_t expect = (k < 20) ? Q16_FROM_INT(20) + k * step : Q16_FROM_INT(30);
+        ok &= filter_stage_step(&s, Q16_FROM_INT(30)) == expect;
+    }
+    // 下降方向同样限幅，小于限幅的变化直接通过
+    ok &= filter_stage_step(&s, Q16_FROM_INT(10)) == Q16_FROM_INT(30) - step;
+    ok &= filter_stage_step(&s, Q16_FROM_INT(30) - step - Q16_FROM_FLOAT(0.1f)) ==
+          Q16_FROM_INT(30) - step - Q16_FROM_FLOAT(0.1f);
+    test_expect("rate limit step response", ok);
+}
+
+static void test_outlier(void)
+{
+    FilterStage s;
+    int         ok = 1;
+
+    filter_outlier_init(&s, Q16_FROM_INT(5), 3);
+    ok &= filter_stage_step(&s, Q16_FROM_INT(40)) == Q16_FROM_INT(40);
+
+    // 单个尖峰被剔除，阈值内的变化直接通过
+    ok &= filter_stage_step(&s, Q16_FROM_INT(80)) == Q16_FROM_INT(40);
+    ok &= filter_stage_step(&s, Q16_FROM_INT(42)) == Q16_FROM_INT(42);
+    ok &= filter_stage_step(&s, Q16_FROM_INT(37)) == Q16_FROM_INT(37);
+
+    // 真实阶跃：连续剔除3次后接受
+    for (int k = 0; k < 3; k++) { ok &= filter_stage_step(&s, Q16_FROM_INT(60)) == Q16_FROM_INT(37); }
+    ok &= filter_stage_step(&s, Q16_FROM_INT(60)) == Q16_FROM_INT(60);
+    ok &= filter_stage_step(&s, Q16_FROM_INT(61)) == Q16_FROM_INT(61);
+    test_expect("outlier rejection", ok);
+
+    // 复位后首个样本直接作为新基准（不与复位前的读数比较）
+    filter_stage_reset(&s);
+    test_expect("outlier reset re-primes", filter_stage_step(&s, Q16_FROM_INT(20)) == Q16_FROM_INT(20));
+}
+
+static void test_chain(void)
+{
+    FilterStage stages[2];
+    FilterChain chain = {stages, 2};
+    q16_t       block[8] = {Q16_FROM_INT(40), Q16_FROM_INT(40), Q16_FROM_INT(90), Q16_FROM_INT(41),
+                            Q16_FROM_INT(41), Q16_FROM_INT(42), Q16_FROM_INT(42), Q16_FROM_INT(43)};
+    q16_t       out[8];
+
+    // 与NTC输出滤波链相同的结构：野值剔除后接中值
+    filter_outlier_init(&stages[0], Q16_FROM_INT(5), 3);
+    filter_median_init(&stages[1], 3);
+    filter_chain_process(&chain, block, out, 8);
+    int ok = 1;
+    for (int k = 0; k < 8; k++) { ok &= out[k] <= Q16_FROM_INT(43); }
+    ok &= out[7] == Q16_FROM_INT(42);
+    test_expect("chain suppresses spike", ok);
+
+    // 复位后中值窗口与野值基准均重新初始化
+    filter_chain_reset(&chain);
+    q16_t x = Q16_FROM_INT(70);
+    filter_chain_process(&chain, &x, &x, 1);
+    test_expect("chain reset re-primes all stages", x == Q16_FROM_INT(70) && stages[1].median.count == 1);
+}
+
+// 基准：每级每样本的周期数（宿主机；目标板为Cortex-M3，64位乘法与除法开销更大）
+static void test_bench(void)
+{
+    static q16_t       inputs[1024];
+    static const char *names[] = {"median(5)", "iir", "biquad", "rate limit", "outlier"};
+    static const q16_t b[3] = {Q16_FROM_FLOAT(0.0201f), Q16_FROM_FLOAT(0.0402f), Q16_FROM_FLOAT(0.0201f)};
+    static const q16_t a[2] = {Q16_FROM_FLOAT(-1.5610f), Q16_FROM_FLOAT(0.6414f)};
+    FilterStage        s;
+    volatile q16_t     sink = 0;
+
+    for (int i = 0; i < 1024; i++) { inputs[i] = test_input(i); }
+    for (int type = FILTER_MEDIAN; type <= FILTER_OUTLIER; type++)
+    {
+        if (type == FILTER_MEDIAN) filter_median_init(&s, 5);
+        else if (type == FILTER_IIR) filter_iir_init(&s, Q16_FROM_FLOAT(0.25f));
+        else if (type == FILTER_BIQUAD) filter_biquad_init(&s, b, a);
+        else if (type == FILTER_RATE_LIMIT) filter_rate_limit_init(&s, Q16_FROM_FLOAT(0.5f));
+        else filter_outlier_init(&s, Q16_FROM_INT(5), 3);
+
+        uint64_t c0 = TEST_CYCLES();
+        for (int i = 0; i < TEST_BENCH_CALLS; i++) { sink += filter_stage_step(&s, inputs[i & 1023]); }
+        printf("per sample (host): %-10s %.1f cycles\n", names[type],
+               (double) (TEST_CYCLES() - c0) / TEST_BENCH_CALLS);
+    }
+    (void) sink;
+}
+
+int main(int argc, char **argv)
+{
+    srand(1);
+    test_median();
+    test_iir();
+    test_biquad();
+    test_rate_limit();
+    test_outlier();
+    test_chain();
+
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) test_bench();
+    if (!test_failed) printf("PASS\n");
+    return test_failed;
+}
@@ -0,0 +1,381 @@
+/**
+ * @file heat_sim.c
+ * @brief 加热闭环仿真：真实加热任务驱动虚拟热对象
+ *
+ * 在宿主机上运行真实的heat_task.c（含heat_ctrl、PID、热模型）、ntc.c（过采样抽取、查找表换算、
+ * 滤波链）与heat.c（PWM输出）。虚拟热对象按TIM1比较值读取各区占空比，以1ms步长积分：
+ *   加热片  C·dT/dt = P·duty - G·(T - T环境)
+ *   传感器  τs·dTs/dt = T - Ts
+ * 每个采样时刻由Beta方程反算传感器温度对应的ADC码，叠加高斯噪声并按ADC位数量化后写入DMA缓冲，
+ * 每64ms写满一块并进入半传输/传输完成回调，超温看门狗按阈值逐样本检查。
+ *
+ * 场景：从环境温度启动2档（45℃），保持后切换到3档（55℃），各阶段报告上升时间（10%→90%）、
+ * 进入±0.5℃的时间、超调、稳态误差（阶段最后5分钟的平均值与最大值）和控制量（平均占空比、
+ * 能耗、每个采样块的平均占空比变化）。--autotune先在2档执行继电自整定，冷却后再运行场景。
+ *
+ * 用法：heat_sim [--capacity J/K] [--loss W/K] [--power W] [--lag s] [--ambient ℃]
+ *                [--noise LSB] [--bits N] [--phase-min N] [--autotune] [--trace]
+ */
+#include "heat.h"
+#include "heat_ctrl.h"
+#include "heat_task.h"
+#include "rtc.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_BLOCK_MS        64      // 一块DMA缓冲的时长（1kHz同步采样，每块每通道NTC_NUM个样本）
+#define SIM_NTC_NUM         64      // 每块每通道样本数（ntc.c的NTC_NUM）
+#define SIM_ADC_MAX         4095
+#define SIM_VREFINT_CODE    1489    // 1.2V / 3.3V 满量程
+#define SIM_NTC_R0          10000.0 // NTC标称电阻（Ω，25℃）
+#define SIM_NTC_BETA        3950.0
+#define SIM_SERIES_R        10000.0
+#define SIM_BAND            0.5     // 到达判定带（℃）
+#define SIM_STEADY_MS       300000  // 稳态误差统计窗口（阶段末尾）
+#define SIM_PHASE_NUM       2
+#define SIM_TUNE_TIMEOUT_MS 1800000
+#define SIM_COOL_MS         1800000 // 自整定后冷却时长
+#define SIM_STARTUP_MS      1000    // 场景开始前的等待时间
+
+// 检查阈值（默认对象参数下的验收标准）
+#define SIM_MAX_OVERSHOOT   1.0 // ℃
+#define SIM_MAX_SS_ERROR    0.2 // ℃，稳态平均误差
+#define SIM_MAX_SS_RIPPLE   0.5 // ℃，稳态最大偏差
+
+// 热对象参数（默认：τ = C/G = 120s，满功率稳态温升 P/G = 60℃）
+typedef struct
+{
+    double capacity_j_k; // 热容
+    double loss_w_k;     // 散热系数
+    double power_w;      // 满占空比功率
+    double lag_s;        // 传感器滞后时间常数
+    double ambient;      // 环境温度
+    double noise_lsb;    // ADC噪声标准差（LSB）
+    int    bits;         // ADC有效位数（量化）
+} SimPlant;
+
+// 单个阶段的响应指标
+typedef struct
+{
+    double   target;
+    double   start_temp;
+    uint64_t start_ms;
+    uint64_t end_ms;
+    double   t10_s, t90_s, band_s; // 上升10%、90%及首次进入±SIM_BAND的时刻（相对阶段起点，<0为未到达）
+    double   max_sensor, max_pad;
+    double   ss_sum, ss_max;       // 稳态窗口误差
+    uint32_t ss_count;
+    double   duty_sum;             // 占空比·块数
+    double   duty_change_sum;      // |Δ占空比|累加
+    uint32_t blocks;
+} SimPhase;
+
+static SimPlant sim_plant = {20.0, 1.0 / 6.0, 10.0, 10.0, 25.0, 2.0, 12};
+static double   sim_pad[HEAT_ZONE_NUM], sim_sensor[HEAT_ZONE_NUM];
+static double   sim_last_duty = 0.0;
+static uint8_t  sim_block = 0;
+static uint8_t  sim_trace = 0;
+static uint8_t  sim_autotune = 0;
+static uint32_t sim_phase_ms = 1200000;
+
+static SimPhase sim_phase[SIM_PHASE_NUM];
+static int      sim_active_phase = -1; // 正在统计的阶段（-1为不统计）
+static uint8_t  sim_done = 0;
+static uint8_t  sim_stopped = 0;       // 加热被意外停止（故障或整定失败）
+static double   sim_tune_s = -1.0;
+static uint8_t  sim_profile_error = 0; // 加热曲线状态与实际不符
+static uint8_t  sim_fault_error = 0;   // 超温故障锁存期间的启动请求留下了待执行的整定/曲线
+static uint8_t  sim_edge_error = 0;    // 加热输出关断沿落入NTC扫描窗口（比较值不小于CC2触发点）
+
+// 各区PWM比较寄存器（与heat.c中的区-通道映射一致：CH4、CH1、CH3）
+static volatile uint32_t *const sim_ccr[HEAT_ZONE_MAX] = {&host_tim1.CCR4, &host_tim1.CCR1, &host_tim1.CCR3};
+
+static double sim_gauss(void)
+{
+    double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+// 传感器温度对应的ADC码：Beta方程求电阻，分压后按ADC位数量化
+static uint16_t sim_adc_code(double temperature)
+{
+    double r = SIM_NTC_R0 * exp(SIM_NTC_BETA * (1.0 / (temperature + 273.15) - 1.0 / 298.15));
+    double code = SIM_ADC_MAX * SIM_SERIES_R / (r + SIM_SERIES_R) + sim_plant.noise_lsb * sim_gauss();
+    double step = (double) (1 << (12 - sim_plant.bits));
+
+    code = floor(code / step + 0.5) * step;
+    if (code < 0.0) code = 0.0;
+    if (code > SIM_ADC_MAX) code = SIM_ADC_MAX;
+    return (uint16_t) code;
+}
+
+static double sim_duty(uint8_t zone)
+{
+    return (double) *sim_ccr[zone] / (host_tim1.ARR + 1);
+}
+
+// 统计当前阶段指标（每块一次，以区0传感器温度为准）
+static void sim_phase_sample(double duty)
+{
+    if (sim_active_phase < 0) return;
+
+    SimPhase *p = &sim_phase[sim_active_phase];
+    double    t = (host_rtos_now() - p->start_ms) / 1000.0;
+    double    rise = (sim_sensor[0] - p->start_temp) / (p->target - p->start_temp);
+    double    error = sim_sensor[0] - p->target;
+
+    if (p->t10_s < 0 && rise >= 0.1) p->t10_s = t;
+    if (p->t90_s < 0 && rise >= 0.9) p->t90_s = t;
+    if (p->band_s < 0 && fabs(error) <= SIM_BAND) p->band_s = t;
+    if (sim_sensor[0] > p->max_sensor) p->max_sensor = sim_sensor[0];
+    if (sim_pad[0] > p->max_pad) p->max_pad = sim_pad[0];
+    if (host_rtos_now() + SIM_STEADY_MS >= p->end_ms)
+    {
+        p->ss_sum += error;
+        p->ss_count++;
+        if (fabs(error) > p->ss_max) p->ss_max = fabs(error);
+    }
+    p->duty_sum += duty;
+    p->duty_change_sum += fabs(duty - sim_last_duty);
+    p->blocks++;
+}
+
+// 虚拟ADC/DMA：每1ms推进对象并采样一次扫描序列，写满一块后进入DMA回调
+static void sim_adc_block(void)
+{
+    uint32_t  length;
+    uint16_t *buffer = host_adc_dma_buffer(&length);
+    uint32_t  channels = length / (2 * SIM_NTC_NUM);
+    double    dt = 0.001;
+
+    for (uint32_t i = 0; i < SIM_NTC_NUM; i++)
+    {
+        uint16_t *scan = &buffer[(sim_block * SIM_NTC_NUM + i) * channels];
+        for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++)
+        {
+            if (*sim_ccr[zone] >= host_tim1.CCR2) sim_edge_error = 1;
+            double loss = sim_plant.loss_w_k * (sim_pad[zone] - sim_plant.ambient);
+            sim_pad[zone] += dt * (sim_plant.power_w * sim_duty(zone) - loss) / sim_plant.capacity_j_k;
+            sim_sensor[zone] += dt * (sim_pad[zone] - sim_sensor[zone]) / sim_plant.lag_s;
+            scan[zone] = sim_adc_code(sim_sensor[zone]);
+        }
+        scan[channels - 1] = SIM_VREFINT_CODE;
+        for (uint32_t ch = 0; ch < channels; ch++) { host_adc_watchdog(scan[ch]); }
+    }
+    host_adc_dma_complete(sim_block == 0);
+    sim_block ^= 1;
+
+    double duty = sim_duty(0) * 100.0;
+    sim_phase_sample(duty);
+    sim_last_duty = duty;
+    if (sim_trace && host_rtos_now() % 1024 == 0)
+    {
+        printf("%8.1f %6.2f %6.2f %6.1f\n", host_rtos_now() / 1000.0, sim_pad[0], sim_sensor[0], duty);
+    }
+}
+
+static void sim_heat_changed(HeatStatus old_status, HeatStatus new_status)
+{
+    (void) old_status;
+    if (new_status == HEAT_STOP && sim_active_phase >= 0) sim_stopped = 1;
+}
+
+static void sim_phase_begin(int index, HeatLevel level)
+{
+    SimPhase *p = &sim_phase[index];
+
+    memset(p, 0, sizeof(*p));
+    p->target = Q16_TO_FLOAT(heat_level_temp[level]);
+    p->start_temp = sim_sensor[0];
+    p->start_ms = host_rtos_now();
+    p->end_ms = p->start_ms + sim_phase_ms;
+    p->t10_s = p->t90_s = p->band_s = -1.0;
+    p->max_sensor = p->max_pad = -1000.0;
+    sim_active_phase = index;
+    heat_set_level(level);
+}
+
+// 继电自整定（2档），成功后停止加热并冷却到接近环境温度
+static int sim_run_autotune(void)
+{
+    uint64_t start = host_rtos_now();
+    uint32_t tuned = RTC_BKP_DR9;
+
+    heat_set_level(HEAT_LEVEL_2);
+    heat_set_autotune(1);
+    while (host_rtos_now() - start < SIM_TUNE_TIMEOUT_MS)
+    {
+        vTaskDelay(pdMS_TO_TICKS(1000));
+        if (HAL_RTCEx_BKUPRead(&hrtc, tuned) & (1U << HEAT_LEVEL_2))
+        {
+            sim_tune_s = (host_rtos_now() - start) / 1000.0;
+            break;
+        }
+    }
+    // 整定完成后（停止加热之前）自整定状态即应清零
+    uint8_t still_active = heat_get_autotune();
+    heat_set_status(HEAT_STOP);
+    if (sim_tune_s < 0) return -1;
+    if (still_active)
+    {
+        printf("FAIL: autotune still reported active after completion\n");
+        return -1;
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(SIM_COOL_MS));
+    return 0;
+}
+
+// 场景任务：按Modbus/按键的调用方式操作加热接口
+static void sim_scenario_task(void *arg)
+{
+    (void) arg;
+
+    // 等待NTC采满第一块（上电后立即操作时测温尚无数据）
+    vTaskDelay(pdMS_TO_TICKS(SIM_STARTUP_MS));
+    if (sim_autotune && sim_run_autotune() != 0)
+    {
+        sim_stopped = 1;
+        sim_done = 1;
+        vTaskDelay(portMAX_DELAY);
+    }
+
+    sim_phase_begin(0, HEAT_LEVEL_2);
+    heat_set_status(HEAT_RUNNING);
+    vTaskDelay(pdMS_TO_TICKS(sim_phase_ms));
+    sim_phase_begin(1, HEAT_LEVEL_3);
+    vTaskDelay(pdMS_TO_TICKS(sim_phase_ms));
+
+    sim_active_phase = -1;
+    heat_set_status(HEAT_STOP);
+
+    // 加热曲线状态：执行中读回曲线编号，手动调档取消后读回0
+    heat_set_profile(1);
+    vTaskDelay(pdMS_TO_TICKS(SIM_STARTUP_MS));
+    sim_profile_error = (heat_get_profile() != 1);
+    heat_set_level(HEAT_LEVEL_1);
+    sim_profile_error |= (heat_get_profile() != HEAT_PROFILE_NONE);
+    heat_set_status(HEAT_STOP);
+
+    // 超温故障锁存：自整定和加热曲线请求被拒绝，清除故障后手动启动不应执行整定或曲线
+    host_adc_watchdog(SIM_ADC_MAX);
+    sim_fault_error = heat_set_autotune(1) || heat_get_autotune();
+    sim_fault_error |= heat_set_profile(1) || heat_get_profile() != HEAT_PROFILE_NONE;
+    heat_clear_fault();
+    sim_fault_error |= !heat_set_status(HEAT_RUNNING) || heat_get_autotune();
+    sim_fault_error |= heat_get_profile() != HEAT_PROFILE_NONE;
+    heat_set_status(HEAT_STOP);
+    sim_done = 1;
+    vTaskDelay(portMAX_DELAY);
+}
+
+static int sim_report(void)
+{
+    int failed = 0;
+
+    printf("plant: C %.1f J/K, G %.3f W/K (tau %.0f s, gain %.2f C/%%), P %.1f W, lag %.1f s, noise %.1f LSB, %d bit\n",
+           sim_plant.capacity_j_k, sim_plant.loss_w_k, sim_plant.capacity_j_k / sim_plant.loss_w_k,
+           sim_plant.power_w / sim_plant.loss_w_k / 100.0, sim_plant.power_w, sim_plant.lag_s, sim_plant.noise_lsb,
+           sim_plant.bits);
+    if (sim_autotune) printf("autotune: %s after %.0f s\n", (sim_tune_s >= 0) ? "done" : "FAILED", sim_tune_s);
+    if (sim_profile_error)
+    {
+        printf("FAIL: profile state not cleared by a level change\n");
+        return 1;
+    }
+    if (sim_edge_error)
+    {
+        printf("FAIL: heater turn-off edge inside the NTC scan window\n");
+        return 1;
+    }
+    if (sim_fault_error)
+    {
+        printf("FAIL: request made during a latched fault ran on the next start\n");
+        return 1;
+    }
+    if (sim_stopped)
+    {
+        printf("FAIL: heating stopped unexpectedly (fault %d)\n", heat_fault_get());
+        return 1;
+    }
+
+    for (int i = 0; i < SIM_PHASE_NUM; i++)
+    {
+        const SimPhase *p = &sim_phase[i];
+        double          overshoot = p->max_sensor - p->target;
+        double          ss_error = p->ss_count ? p->ss_sum / p->ss_count : NAN;
+        double          duty = p->duty_sum / p->blocks;
+
+        printf("step %.1f -> %.0f C: rise %.0f s, within %.1f C at %.0f s, overshoot %.2f C (pad %.2f C)\n",
+               p->start_temp, p->target, p->t90_s - p->t10_s, SIM_BAND, p->band_s, overshoot,
+               p->max_pad - p->target);
+        printf("  steady state: error %+.3f C mean, %.3f C max; effort: duty %.1f%%, %.2f Wh, %.3f%%/block change\n",
+               ss_error, p->ss_max, duty, duty / 100.0 * sim_plant.power_w * (p->end_ms - p->start_ms) / 3.6e6,
+               p->duty_change_sum / p->blocks);
+
+        if (p->t90_s < 0 || p->band_s < 0 || overshoot > SIM_MAX_OVERSHOOT || fabs(ss_error) > SIM_MAX_SS_ERROR ||
+            p->ss_max > SIM_MAX_SS_RIPPLE)
+        {
+            printf("FAIL: step to %.0f C outside limits (overshoot %.1f, error %.1f / %.1f C)\n", p->target,
+                   SIM_MAX_OVERSHOOT, SIM_MAX_SS_ERROR, SIM_MAX_SS_RIPPLE);
+            failed = 1;
+        }
+    }
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--autotune") == 0) sim_autotune = 1;
+        else if (strcmp(arg, "--trace") == 0) sim_trace = 1;
+        else if (value != NULL && strcmp(arg, "--capacity") == 0) sim_plant.capacity_j_k = atof(argv[++i]);
+        else if (value != NULL && strcmp(arg, "--loss") == 0) sim_plant.loss_w_k = atof(argv[++i]);
+        else if (value != NULL && strcmp(arg, "--power") == 0) sim_plant.power_w = atof(argv[++i]);
+        else if (value != NULL && strcmp(arg, "--lag") == 0) sim_plant.lag_s = atof(argv[++i]);
+        else if (value != NULL && strcmp(arg, "--ambient") == 0) sim_plant.ambient = atof(argv[++i]);
+        else if (value != NULL && strcmp(arg, "--noise") == 0) sim_plant.noise_lsb = atof(argv[++i]);
+        else if (value != NULL && strcmp(arg, "--bits") == 0) sim_plant.bits = atoi(argv[++i]);
+        else if (value != NULL && strcmp(arg, "--phase-min") == 0) sim_phase_ms = (uint32_t) atoi(argv[++i]) * 60000;
+        else
+        {
+            printf("usage: %s [--capacity J/K] [--loss W/K] [--power W] [--lag s] [--ambient C] [--noise LSB]\n"
+                   "       [--bits N] [--phase-min N] [--autotune] [--trace]\n",
+                   argv[0]);
+            return 2;
+        }
+    }
+    if (sim_plant.bits < 1 || sim_plant.bits > 12 || sim_phase_ms <= SIM_STEADY_MS || sim_plant.capacity_j_k <= 0 ||
+        sim_plant.loss_w_k <= 0 || sim_plant.lag_s <= 0)
+    {
+        printf("invalid plant parameters\n");
+        return 2;
+    }
+
+    for (uint8_t zone = 0; zone < HEAT_ZONE_NUM; zone++) { sim_pad[zone] = sim_sensor[zone] = sim_plant.ambient; }
+    srand(1);
+
+    RTC_Init();
+    heat_task_init();
+    heat_set_status_hook(sim_heat_changed);
+    xTaskCreate(sim_scenario_task, "sim_scenario", 256, NULL, 1, NULL);
+    host_rtos_periodic(SIM_BLOCK_MS, sim_adc_block);
+    if (sim_trace) printf("# time_s pad_C sensor_C duty_%%\n");
+
+    while (!sim_done) { host_rtos_run(60 * configTICK_RATE_HZ); }
+
+    int failed = sim_report();
+    if (!failed) printf("PASS\n");
+    return failed;
+}
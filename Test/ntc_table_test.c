@@ -0,0 +1,167 @@
+/**
+ * @file ntc_table_test.c
+ * @brief NTC查找表测试：初始化前拒绝换算、标称表插值精度、两点校准后的查找表
+ *
+ * 标称表精度对-20~100℃内全部过采样ADC码逐一与Beta方程（双精度）比较，
+ * 与Tools/ntc_table_gen.py的报告一致。校准部分以DMA缓冲注入两个参考点的ADC码，
+ * 检查校准后的换算结果符合 gain·T标称 + offset，清除校准后恢复标称表。
+ * 抽取部分以含尖峰的随机块检查截尾平均与排序后截尾求和的结果一致。
+ *
+ * 用法：ntc_table_test
+ */
+#include "ntc.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_ADC_MAX     4095
+#define TEST_OVERSAMPLE  8    // 过采样码的小数倍数（NTC_OVERSAMPLE_BITS = 3）
+#define TEST_NOMINAL_TOL 0.08 // 标称表插值误差上限（生成器报告最大0.0745℃）
+#define TEST_CAL_TOL     0.09 // 校准后误差上限（插值误差加表项舍入）
+#define TEST_NUM         64   // 每块每通道样本数（NTC_NUM）
+#define TEST_TRIM        2    // 两端各剔除的样本数（PWM同步触发时的NTC_TRIM）
+#define TEST_BLOCKS      200
+
+static int test_failed = 0;
+
+// Beta方程：ADC码（可带小数）对应的温度
+static double test_beta(double code)
+{
+    double r = 10000.0 * (TEST_ADC_MAX / code - 1.0);
+    return 1.0 / (1.0 / 298.15 + log(r / 10000.0) / 3950.0) - 273.15;
+}
+
+// 温度对应的整数ADC码
+static uint16_t test_code(double temperature)
+{
+    double r = 10000.0 * exp(3950.0 * (1.0 / (temperature + 273.15) - 1.0 / 298.15));
+    return (uint16_t) lround(TEST_ADC_MAX * 10000.0 / (r + 10000.0));
+}
+
+// 所有通道的DMA样本置为同一ADC码并完成一块
+static void test_dma_fill(uint16_t code)
+{
+    uint32_t  length;
+    uint16_t *buffer = host_adc_dma_buffer(&length);
+
+    for (uint32_t i = 0; i < length; i++) { buffer[i] = code; }
+    host_adc_dma_complete(1);
+}
+
+// 有效范围内全部过采样码与期望值（gain·Beta + offset）比较，返回最大误差
+static double test_sweep(double gain, double offset, double *rms)
+{
+    double   worst = 0.0, sum_sq = 0.0;
+    uint32_t count = 0;
+
+    for (uint32_t code = 1; code < TEST_ADC_MAX * TEST_OVERSAMPLE; code++)
+    {
+        double expect = gain * test_beta((double) code / TEST_OVERSAMPLE) + offset;
+        q16_t  temperature;
+
+        if (expect < -19.9 || expect > 99.9) continue;
+        if (NTC_AdcToTemperature(0, code, &temperature) != 0)
+        {
+            printf("FAIL: code %u (%.2f C) rejected\n", code, expect);
+            test_failed = 1;
+            return INFINITY;
+        }
+
+        double error = fabs(Q16_TO_FLOAT(temperature) - expect);
+        if (error > worst) worst = error;
+        sum_sq += error * error;
+        count++;
+    }
+    *rms = sqrt(sum_sq / count);
+    return worst;
+}
+
+static void test_expect(const char *what, int ok)
+{
+    if (ok) return;
+    printf("FAIL: %s\n", what);
+    test_failed = 1;
+}
+
+static int test_compare_u16(const void *a, const void *b)
+{
+    return (int) *(const uint16_t *) a - (int) *(const uint16_t *) b;
+}
+
+// 抽取：区0写入随机块（含重复值和两端尖峰），首个读数（滤波链复位后直接输出）与参考截尾平均比较
+static void test_decimate(void)
+{
+    uint32_t  length;
+    uint16_t *buffer = host_adc_dma_buffer(&length);
+    uint32_t  channels = length / (2 * TEST_NUM);
+    int       mismatches = 0;
+
+    for (int n = 0; n < TEST_BLOCKS; n++)
+    {
+        uint16_t samples[TEST_NUM];
+        uint32_t sum = 0;
+
+        for (int i = 0; i < TEST_NUM; i++)
+        {
+            samples[i] = (uint16_t) (2000 + rand() % 16);
+            if (rand() % 16 == 0) samples[i] = (uint16_t) (rand() % 2 ? 4000 : 100);
+            for (uint32_t ch = 0; ch < channels; ch++) { buffer[i * channels + ch] = samples[i]; }
+        }
+        host_adc_dma_complete(1);
+
+        qsort(samples, TEST_NUM, sizeof(uint16_t), test_compare_u16);
+        for (int i = TEST_TRIM; i < TEST_NUM - TEST_TRIM; i++) { sum += samples[i]; }
+
+        q16_t expect, temperature;
+        NTC_AdcToTemperature(0, (sum * TEST_OVERSAMPLE) / (TEST_NUM - 2 * TEST_TRIM), &expect);
+        NTC_FilterReset();
+        if (NTC_Read(0, &temperature) != 0 || temperature != expect) mismatches++;
+    }
+    printf("decimation vs. sorted trimmed mean: %d/%d mismatches\n", mismatches, TEST_BLOCKS);
+    test_expect("trimmed mean matches sorted reference", mismatches == 0);
+}
+
+int main(void)
+{
+    q16_t  temperature;
+    double rms;
+
+    // 查找表生成前：任何读数都无效（旧实现在此返回0℃）
+    test_expect("conversion before NTC_Init must fail",
+                NTC_AdcToTemperature(0, test_code(25.0) * TEST_OVERSAMPLE, &temperature) != 0);
+
+    NTC_Init();
+    test_expect("open sensor (code 0) must be invalid", NTC_AdcToTemperature(0, 0, &temperature) != 0);
+    test_expect("shorted sensor (full scale) must be invalid",
+                NTC_AdcToTemperature(0, TEST_ADC_MAX * TEST_OVERSAMPLE, &temperature) != 0);
+
+    double worst = test_sweep(1.0, 0.0, &rms);
+    printf("nominal table vs. Beta equation (-20..100 C): max %.4f C, RMS %.4f C\n", worst, rms);
+    test_expect("nominal table accuracy", worst <= TEST_NOMINAL_TOL);
+
+    // 两点校准：读数在30℃、60℃处分别偏低1.0℃、1.5℃
+    uint16_t code1 = test_code(30.0), code2 = test_code(60.0);
+    double   raw1 = test_beta(code1), raw2 = test_beta(code2);
+    double   ref1 = raw1 + 1.0, ref2 = raw2 + 1.5;
+
+    test_dma_fill(code1);
+    test_expect("calibration point 1", NTC_CalCapture(1, q16_from_float((float) ref1)) == 0);
+    test_dma_fill(code2);
+    test_expect("calibration point 2", NTC_CalCapture(2, q16_from_float((float) ref2)) == 0);
+    test_expect("calibration state", NTC_CalGetState() == NTC_CAL_DONE);
+
+    double gain = (ref2 - ref1) / (raw2 - raw1);
+    worst = test_sweep(gain, ref1 - gain * raw1, &rms);
+    printf("calibrated table (gain %.4f): max %.4f C, RMS %.4f C\n", gain, worst, rms);
+    test_expect("calibrated table accuracy", worst <= TEST_CAL_TOL);
+
+    NTC_CalClear();
+    worst = test_sweep(1.0, 0.0, &rms);
+    test_expect("nominal table restored after clearing calibration", worst <= TEST_NOMINAL_TOL);
+
+    test_decimate();
+
+    if (!test_failed) printf("PASS\n");
+    return test_failed;
+}
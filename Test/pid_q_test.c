@@ -0,0 +1,167 @@
+/**
+ * @file pid_q_test.c
+ * @brief 定点PID与浮点PID的等价性测试及耗时基准
+ *
+ * 以相同增益、限幅和输入序列分别驱动PID()与PID_Q()：输入由一阶对象在浮点PID输出下
+ * 产生，并叠加测量噪声和设定值阶跃，覆盖积分启用/清空、积分限幅、输出饱和与测量值微分。
+ * 逐步比较输出（浮点版本取整到1%，允许0.5%取整差加定点误差）和积分状态。
+ *
+ * 用法：pid_q_test [--bench]
+ */
+#include "pid.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TEST_CYCLES() __rdtsc()
+#else
+#define TEST_CYCLES() 0ULL
+#endif
+
+#define TEST_CASES        500
+#define TEST_STEPS        3000
+#define TEST_OUTPUT_TOL   0.6f  // 浮点输出取整误差0.5加定点舍入
+#define TEST_INTEGRAL_TOL 0.05f // 积分状态允许的累计误差（%，q16_mul截断每步不超过2^-16）
+#define TEST_BENCH_CALLS  2000000
+
+typedef struct
+{
+    float    Kp, Ki, Kd;
+    float    max_integral;
+    uint16_t dt_ms;
+} TestGains;
+
+static float test_rand(float low, float high)
+{
+    return low + (high - low) * ((float) rand() / (float) RAND_MAX);
+}
+
+static void test_gains_random(TestGains *g)
+{
+    static const uint16_t periods[] = {100, 250, 1000};
+
+    g->Kp = test_rand(1.0f, 20.0f);
+    g->Ki = test_rand(0.01f, 0.5f);
+    g->Kd = test_rand(0.0f, 10.0f);
+    g->max_integral = test_rand(10.0f, 60.0f);
+    g->dt_ms = periods[rand() % 3];
+}
+
+// 一个随机闭环场景：返回输出与积分的最大偏差
+static void test_case(const TestGains *g, float *max_out_err, float *max_int_err)
+{
+    PID_Controller   pid_f;
+    PID_Q_Controller pid_q;
+
+    PID_Init(&pid_f, g->Kp, g->Ki, g->Kd, g->max_integral, 0.0f, 100.0f);
+    PID_Q_Init(&pid_q, q16_from_float(g->Kp), q16_from_float(g->Ki), q16_from_float(g->Kd),
+               q16_from_float(g->max_integral), 0, Q16_FROM_INT(100));
+
+    // 增益以定点表示为准，浮点版本使用相同的量化值，只比较运算过程的差异
+    pid_f.Kp = Q16_TO_FLOAT(pid_q.Kp);
+    pid_f.Ki = Q16_TO_FLOAT(pid_q.Ki);
+    pid_f.Kd = Q16_TO_FLOAT(pid_q.Kd);
+    pid_f.max_integral = Q16_TO_FLOAT(pid_q.max_integral);
+
+    float temp = test_rand(15.0f, 30.0f);
+    float setpoint = test_rand(35.0f, 60.0f);
+    float tau_s = test_rand(30.0f, 300.0f);
+    float gain = test_rand(0.2f, 0.6f); // ℃/%
+    float dt = g->dt_ms / 1000.0f;
+
+    for (int step = 0; step < TEST_STEPS; step++)
+    {
+        if (step == TEST_STEPS / 2) setpoint = test_rand(30.0f, 60.0f);
+
+        // 测量值量化到1/128℃（与NTC查找表分辨率一致），两种控制器看到相同输入
+        float measured = roundf((temp + test_rand(-0.05f, 0.05f)) * 128.0f) / 128.0f;
+        q16_t measured_q = q16_from_float(measured);
+        q16_t setpoint_q = q16_from_float(setpoint);
+
+        uint16_t out_f = PID(&pid_f, Q16_TO_FLOAT(measured_q), Q16_TO_FLOAT(setpoint_q), g->dt_ms);
+        q16_t    out_q = PID_Q(&pid_q, measured_q, setpoint_q, g->dt_ms);
+
+        float out_err = fabsf(Q16_TO_FLOAT(out_q) - out_f);
+        float int_err = fabsf(Q16_TO_FLOAT(pid_q.integral) - pid_f.integral);
+        if (out_err > *max_out_err) *max_out_err = out_err;
+        if (int_err > *max_int_err) *max_int_err = int_err;
+
+        // 一阶对象：dT/dt = (25 + K·u - T) / τ
+        temp += dt * (25.0f + gain * out_f - temp) / tau_s;
+    }
+}
+
+static int test_equivalence(void)
+{
+    float max_out_err = 0.0f, max_int_err = 0.0f;
+
+    srand(1);
+    for (int i = 0; i < TEST_CASES; i++)
+    {
+        TestGains g;
+        test_gains_random(&g);
+        test_case(&g, &max_out_err, &max_int_err);
+    }
+
+    printf("PID_Q vs PID: %d cases x %d steps, max output diff %.4f%% (rounding 0.5), max integral diff %.5f%%\n",
+           TEST_CASES, TEST_STEPS, max_out_err, max_int_err);
+    if (max_out_err > TEST_OUTPUT_TOL || max_int_err > TEST_INTEGRAL_TOL)
+    {
+        printf("FAIL: tolerance %.2f / %.3f exceeded\n", TEST_OUTPUT_TOL, TEST_INTEGRAL_TOL);
+        return 1;
+    }
+    return 0;
+}
+
+static double test_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// 基准：同一输入序列下每次调用的耗时。宿主机有硬件浮点，两者差距远小于目标板
+// （目标板无FPU，浮点版本的乘除与比较均为软浮点库调用）
+static void test_bench(void)
+{
+    static q16_t     inputs[1024];
+    PID_Controller   pid_f;
+    PID_Q_Controller pid_q;
+    volatile q16_t   sink = 0;
+
+    for (int i = 0; i < 1024; i++) { inputs[i] = Q16_FROM_INT(40) + (rand() % Q16_FROM_INT(12)); }
+    PID_Init(&pid_f, 10.0f, 0.1f, 4.5f, 40.0f, 0.0f, 100.0f);
+    PID_Q_Init(&pid_q, Q16_FROM_INT(10), Q16_FROM_FLOAT(0.1f), Q16_FROM_FLOAT(4.5f), Q16_FROM_INT(40), 0,
+               Q16_FROM_INT(100));
+
+    double   t0 = test_now_ns();
+    uint64_t c0 = TEST_CYCLES();
+    for (int i = 0; i < TEST_BENCH_CALLS; i++)
+    {
+        sink += PID(&pid_f, Q16_TO_FLOAT(inputs[i & 1023]), 50.0f, 100);
+    }
+    double f_ns = (test_now_ns() - t0) / TEST_BENCH_CALLS;
+    double f_cyc = (double) (TEST_CYCLES() - c0) / TEST_BENCH_CALLS;
+
+    t0 = test_now_ns();
+    c0 = TEST_CYCLES();
+    for (int i = 0; i < TEST_BENCH_CALLS; i++) { sink += PID_Q(&pid_q, inputs[i & 1023], Q16_FROM_INT(50), 100); }
+    double q_ns = (test_now_ns() - t0) / TEST_BENCH_CALLS;
+    double q_cyc = (double) (TEST_CYCLES() - c0) / TEST_BENCH_CALLS;
+
+    printf("per call (host): PID %.1f ns / %.0f cycles, PID_Q %.1f ns / %.0f cycles\n", f_ns, f_cyc, q_ns, q_cyc);
+    (void) sink;
+}
+
+int main(int argc, char **argv)
+{
+    int failed = test_equivalence();
+
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) test_bench();
+    if (!failed) printf("PASS\n");
+    return failed;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file thermal_model_test.c
+ * @brief 热模型辨识与定点预估测试
+ *
+ * 以已知一阶对象（τ=120s，K=0.6℃/%，环境25℃，传感器滞后10s）在随机占空比阶跃下运行1小时，
+ * 测量值叠加噪声并量化到1/128℃。检查辨识参数收敛到真值、前馈占空比与解析值一致，
+ * 以及定点模型的加热片与传感器温差（Smith预估补偿量）跟随对象真值。
+ * 多个随机序列与两种控制周期下运行，覆盖协方差失去正定性导致参数发散的情形。
+ *
+ * 用法：thermal_model_test
+ */
+#include "thermal_model.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_TAU_S     120.0f
+#define TEST_GAIN      0.6f  // ℃/%
+#define TEST_AMBIENT   25.0f
+#define TEST_LAG_S     10.0f
+#define TEST_RUN_MS    3600000U
+#define TEST_STEP_MS   50000U // 占空比阶跃间隔
+#define TEST_SEEDS     8
+#define TEST_PARAM_TOL 0.02f  // 参数相对误差
+#define TEST_FF_TOL    0.2f   // 前馈占空比误差（%）
+#define TEST_COMP_TOL  0.05f  // 补偿量误差（℃）
+
+static int test_run(uint16_t dt_ms, unsigned seed)
+{
+    static ThermalModel m;
+    float               pad = TEST_AMBIENT, sensor = TEST_AMBIENT, duty = 0.0f;
+    float               dt = dt_ms / 1000.0f;
+    float               max_comp_err = 0.0f;
+
+    thermal_model_init(&m, TEST_LAG_S);
+    srand(seed);
+    for (uint32_t t = 0; t < TEST_RUN_MS; t += dt_ms)
+    {
+        if (t % TEST_STEP_MS == 0) duty = (float) (rand() % 100);
+
+        pad += dt * (TEST_AMBIENT + TEST_GAIN * duty - pad) / TEST_TAU_S;
+        sensor += (pad - sensor) * dt / (TEST_LAG_S + dt);
+        float measured = roundf((sensor + (rand() % 101 - 50) * 0.001f) * 128.0f) / 128.0f;
+        thermal_model_update(&m, q16_from_float(measured), q16_from_float(duty), dt_ms);
+
+        // 后半段模型应已收敛，预估补偿量与对象真值比较
+        if (t >= TEST_RUN_MS / 2)
+        {
+            float err = fabsf(Q16_TO_FLOAT(thermal_model_compensate(&m, 0)) - (pad - sensor));
+            if (err > max_comp_err) max_comp_err = err;
+        }
+    }
+
+    const float truth[3] = {1.0f / TEST_TAU_S, TEST_GAIN / TEST_TAU_S, TEST_AMBIENT / TEST_TAU_S};
+    float       max_param_err = 0.0f;
+    for (int i = 0; i < 3; i++)
+    {
+        float err = fabsf(m.theta[i] - truth[i]) / truth[i];
+        if (err > max_param_err) max_param_err = err;
+    }
+    float ff = Q16_TO_FLOAT(thermal_model_feedforward(&m, Q16_FROM_INT(45)));
+    float ff_err = fabsf(ff - (45.0f - TEST_AMBIENT) / TEST_GAIN);
+
+    int failed = !thermal_model_valid(&m) || max_param_err > TEST_PARAM_TOL || ff_err > TEST_FF_TOL ||
+                 max_comp_err > TEST_COMP_TOL;
+    printf("%s dt %4u ms seed %u: valid %u, param err %.2f%%, feedforward(45) %.3f%%, compensation err %.4f\n",
+           failed ? "FAIL" : "ok  ", dt_ms, seed, thermal_model_valid(&m), max_param_err * 100.0f, ff,
+           max_comp_err);
+    return failed;
+}
+
+int main(void)
+{
+    static const uint16_t periods[] = {100, 1000};
+    int                   failed = 0;
+
+    for (int p = 0; p < 2; p++)
+    {
+        for (unsigned seed = 1; seed <= TEST_SEEDS; seed++) { failed |= test_run(periods[p], seed); }
+    }
+    if (!failed) printf("PASS\n");
+    return failed;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file timestamp_test.c
+ * @brief 统一时间戳服务测试：DWT插值与RTC秒边沿对齐，秒中断延迟时UTC时间戳不倒退
+ */
+#include "rtc.h"
+#include "timestamp.h"
+
+#include <stdio.h>
+
+#define TEST_UTC        1748736000UL // 2025-06-01 00:00:00
+#define TEST_CYCLES_US  64U          // 64MHz
+
+static int test_failed = 0;
+
+static void test_expect(const char *what, uint64_t got, uint64_t expect)
+{
+    if (got == expect) return;
+    printf("FAIL %s: got %llu, expected %llu\n", what, (unsigned long long) got, (unsigned long long) expect);
+    test_failed = 1;
+}
+
+static void test_advance_us(uint32_t us)
+{
+    DWT->CYCCNT += us * TEST_CYCLES_US;
+}
+
+static void test_rtc_second(void)
+{
+    uint32_t counter = ((RTC->CNTH << 16) | RTC->CNTL) + 1;
+
+    RTC->CNTH = counter >> 16;
+    RTC->CNTL = counter & 0xFFFF;
+    SET_BIT(RTC->CRL, RTC_CRL_SECF);
+    RTC_SecondIRQHandler();
+}
+
+int main(void)
+{
+    RTC_Init();
+    RTC_SetUTC(TEST_UTC);
+    RTC->DIVL = 0x7FFF; // 预分频余数为PRL：秒边沿刚过
+    timestamp_init();
+
+    uint64_t base = (uint64_t) TEST_UTC * 1000000U;
+    test_expect("utc at init", timestamp_utc_us(), base);
+
+    test_advance_us(500000);
+    test_expect("utc interpolated", timestamp_utc_us(), base + 500000);
+    test_expect("mono interpolated", timestamp_mono_us(), 500000);
+
+    // 秒中断延迟0.5秒：UTC停在本秒末，单调时间继续增长
+    test_advance_us(1000000);
+    test_expect("utc clamped", timestamp_utc_us(), base + 999999);
+    test_expect("mono unclamped", timestamp_mono_us(), 1500000);
+
+    // 延迟的秒中断到达：新锚点为下一整秒，不早于上次返回值
+    uint64_t before = timestamp_utc_us();
+    test_rtc_second();
+    uint64_t after = timestamp_utc_us();
+    if (after < before)
+    {
+        printf("FAIL utc went backwards: %llu -> %llu\n", (unsigned long long) before, (unsigned long long) after);
+        test_failed = 1;
+    }
+    test_expect("utc after late tick", after, base + 1000000);
+
+    test_advance_us(250000);
+    test_expect("utc next second", timestamp_utc_us(), base + 1250000);
+
+    if (!test_failed) printf("PASS\n");
+    return test_failed;
+}
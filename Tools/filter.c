@@ -0,0 +1,173 @@
+#include "filter.h"
+
+// 内部函数：在有序数组中二分查找第一个不小于x的位置
+static uint8_t filter_median_lower_bound(const q16_t *sorted, uint8_t count, q16_t x)
+{
+    uint8_t low = 0;
+    uint8_t high = count;
+
+    while (low < high)
+    {
+        uint8_t mid = (uint8_t) ((low + high) / 2);
+        if (sorted[mid] < x) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+// 内部函数：滑动中值。定位为O(log n)，窗口不超过FILTER_MEDIAN_MAX，数组移动开销可忽略
+static q16_t filter_median_step(FilterMedian *m, q16_t x)
+{
+    if (m->count == m->size)
+    {
+        // 窗口已满：从有序数组中删除最旧样本
+        uint8_t pos = filter_median_lower_bound(m->sorted, m->count, m->window[m->head]);
+        for (uint8_t i = pos; i + 1 < m->count; i++) { m->sorted[i] = m->sorted[i + 1]; }
+        m->count--;
+        m->window[m->head] = x;
+        m->head = (uint8_t) ((m->head + 1) % m->size);
+    }
+    else { m->window[(m->head + m->count) % m->size] = x; }
+
+    // 插入新样本
+    uint8_t pos = filter_median_lower_bound(m->sorted, m->count, x);
+    for (uint8_t i = m->count; i > pos; i--) { m->sorted[i] = m->sorted[i - 1]; }
+    m->sorted[pos] = x;
+    m->count++;
+
+    return m->sorted[m->count / 2];
+}
+
+// 内部函数：二阶节（64位累加，避免中间结果溢出）
+static q16_t filter_biquad_step(FilterBiquad *f, q16_t x)
+{
+    int64_t acc = (int64_t) f->b[0] * x + (int64_t) f->b[1] * f->x[0] + (int64_t) f->b[2] * f->x[1] -
+                  (int64_t) f->a[0] * f->y[0] - (int64_t) f->a[1] * f->y[1];
+    q16_t   y = (q16_t) (acc >> Q16_SHIFT);
+
+    f->x[1] = f->x[0];
+    f->x[0] = x;
+    f->y[1] = f->y[0];
+    f->y[0] = y;
+    return y;
+}
+
+void filter_median_init(FilterStage *s, uint8_t size)
+{
+    s->type = FILTER_MEDIAN;
+    s->median.size = (size == 0) ? 1 : ((size > FILTER_MEDIAN_MAX) ? FILTER_MEDIAN_MAX : size);
+    filter_stage_reset(s);
+}
+
+void filter_iir_init(FilterStage *s, q16_t alpha)
+{
+    s->type = FILTER_IIR;
+    s->iir.alpha = q16_clamp(alpha, 1, Q16_ONE);
+    filter_stage_reset(s);
+}
+
+void filter_biquad_init(FilterStage *s, const q16_t b[3], const q16_t a[2])
+{
+    s->type = FILTER_BIQUAD;
+    for (uint8_t i = 0; i < 3; i++) { s->biquad.b[i] = b[i]; }
+    for (uint8_t i = 0; i < 2; i++) { s->biquad.a[i] = a[i]; }
+    filter_stage_reset(s);
+}
+
+void filter_rate_limit_init(FilterStage *s, q16_t max_step)
+{
+    s->type = FILTER_RATE_LIMIT;
+    s->rate.max_step = max_step;
+    filter_stage_reset(s);
+}
+
+void filter_outlier_init(FilterStage *s, q16_t threshold, uint8_t max_reject)
+{
+    s->type = FILTER_OUTLIER;
+    s->outlier.threshold = threshold;
+    s->outlier.max_reject = max_reject;
+    filter_stage_reset(s);
+}
+
+void filter_stage_reset(FilterStage *s)
+{
+    s->primed = 0;
+    if (s->type == FILTER_MEDIAN)
+    {
+        s->median.count = 0;
+        s->median.head = 0;
+    }
+    if (s->type == FILTER_OUTLIER) s->outlier.rejected = 0;
+}
+
+q16_t filter_stage_step(FilterStage *s, q16_t x)
+{
+    // 首个样本：以该样本为稳态初始化状态，避免从0开始的启动瞬态
+    if (!s->primed)
+    {
+        s->primed = 1;
+        switch (s->type)
+        {
+            case FILTER_IIR:
+                s->iir.y = x;
+                return x;
+            case FILTER_BIQUAD:
+                // 按单位直流增益初始化历史
+                s->biquad.x[0] = s->biquad.x[1] = x;
+                s->biquad.y[0] = s->biquad.y[1] = x;
+                return x;
+            case FILTER_RATE_LIMIT:
+                s->rate.y = x;
+                return x;
+            case FILTER_OUTLIER:
+                s->outlier.last = x;
+                return x;
+            default:
+                break;
+        }
+    }
+
+    switch (s->type)
+    {
+        case FILTER_MEDIAN:
+            return filter_median_step(&s->median, x);
+        case FILTER_IIR:
+            s->iir.y += q16_mul(s->iir.alpha, x - s->iir.y);
+            return s->iir.y;
+        case FILTER_BIQUAD:
+            return filter_biquad_step(&s->biquad, x);
+        case FILTER_RATE_LIMIT:
+            s->rate.y += q16_clamp(x - s->rate.y, -s->rate.max_step, s->rate.max_step);
+            return s->rate.y;
+        case FILTER_OUTLIER:
+        {
+            q16_t diff = x - s->outlier.last;
+            if ((diff > s->outlier.threshold || diff < -s->outlier.threshold) &&
+                s->outlier.rejected < s->outlier.max_reject)
+            {
+                s->outlier.rejected++;
+                return s->outlier.last;
+            }
+            s->outlier.rejected = 0;
+            s->outlier.last = x;
+            return x;
+        }
+        default:
+            return x;
+    }
+}
+
+void filter_chain_reset(FilterChain *chain)
+{
+    for (uint8_t i = 0; i < chain->num; i++) { filter_stage_reset(&chain->stages[i]); }
+}
+
+void filter_chain_process(FilterChain *chain, const q16_t *in, q16_t *out, uint16_t n)
+{
+    for (uint16_t k = 0; k < n; k++)
+    {
+        q16_t x = in[k];
+        for (uint8_t i = 0; i < chain->num; i++) { x = filter_stage_step(&chain->stages[i], x); }
+        out[k] = x;
+    }
+}
@@ -0,0 +1,125 @@
+#ifndef FILTER_H
+#define FILTER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*----------------------------------include-----------------------------------*/
+#include "fixed.h"
+#include <stdint.h>
+/*-----------------------------------macro------------------------------------*/
+#define FILTER_MEDIAN_MAX 9 // 滑动中值窗口最大长度
+/*----------------------------------typedef-----------------------------------*/
+// 滤波级类型
+typedef enum
+{
+    FILTER_MEDIAN = 0, // 滑动窗口中值
+    FILTER_IIR,        // 一阶低通 y += α·(x - y)
+    FILTER_BIQUAD,     // 二阶节（直接I型）
+    FILTER_RATE_LIMIT, // 变化率限幅
+    FILTER_OUTLIER     // 野值剔除
+} FilterType;
+
+// 滑动中值：环形窗口保存时间顺序，有序数组二分查找定位删除/插入位置
+typedef struct
+{
+    q16_t   window[FILTER_MEDIAN_MAX]; // 按时间顺序的样本
+    q16_t   sorted[FILTER_MEDIAN_MAX]; // 按大小排序的样本
+    uint8_t size;                      // 窗口长度
+    uint8_t count;                     // 已有样本数
+    uint8_t head;                      // 最旧样本位置
+} FilterMedian;
+
+// 一阶低通
+typedef struct
+{
+    q16_t alpha; // 平滑系数(0~1]
+    q16_t y;     // 输出
+} FilterIir;
+
+// 二阶节：y = b0·x0 + b1·x1 + b2·x2 - a1·y1 - a2·y2（系数Q16.16，a0归一化为1）
+typedef struct
+{
+    q16_t b[3];
+    q16_t a[2];
+    q16_t x[2]; // 输入历史 x[n-1], x[n-2]
+    q16_t y[2]; // 输出历史 y[n-1], y[n-2]
+} FilterBiquad;
+
+// 变化率限幅：每个样本输出变化不超过max_step
+typedef struct
+{
+    q16_t max_step;
+    q16_t y;
+} FilterRateLimit;
+
+// 野值剔除：偏离上次输出超过threshold的样本以上次输出代替；
+// 连续剔除max_reject次后认为是真实阶跃并接受
+typedef struct
+{
+    q16_t   threshold;
+    q16_t   last;
+    uint8_t max_reject;
+    uint8_t rejected; // 已连续剔除次数
+} FilterOutlier;
+
+// 滤波级：状态保存在结构体内（静态分配），首个样本用于初始化状态
+typedef struct
+{
+    FilterType type;
+    uint8_t    primed; // 是否已由首个样本初始化
+    union
+    {
+        FilterMedian    median;
+        FilterIir       iir;
+        FilterBiquad    biquad;
+        FilterRateLimit rate;
+        FilterOutlier   outlier;
+    };
+} FilterStage;
+
+// 滤波链：按数组顺序依次通过各级
+typedef struct
+{
+    FilterStage *stages;
+    uint8_t      num;
+} FilterChain;
+/*----------------------------------variable----------------------------------*/
+
+/*-------------------------------------os-------------------------------------*/
+
+/*----------------------------------function----------------------------------*/
+void filter_median_init(FilterStage *s, uint8_t size);
+void filter_iir_init(FilterStage *s, q16_t alpha);
+void filter_biquad_init(FilterStage *s, const q16_t b[3], const q16_t a[2]);
+void filter_rate_limit_init(FilterStage *s, q16_t max_step);
+void filter_outlier_init(FilterStage *s, q16_t threshold, uint8_t max_reject);
+
+/**
+ * @brief 清除滤波级状态（参数保留），下一个样本重新初始化
+ */
+void filter_stage_reset(FilterStage *s);
+
+/**
+ * @brief 单个样本通过一个滤波级
+ */
+q16_t filter_stage_step(FilterStage *s, q16_t x);
+
+/**
+ * @brief 清除滤波链各级状态
+ */
+void filter_chain_reset(FilterChain *chain);
+
+/**
+ * @brief 一块样本依次通过滤波链（in与out可为同一数组）
+ */
+void filter_chain_process(FilterChain *chain, const q16_t *in, q16_t *out, uint16_t n);
+/*------------------------------------test------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FILTER_H */
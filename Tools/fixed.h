@@ -0,0 +1,55 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*----------------------------------include-----------------------------------*/
+#include <stdint.h>
+/*-----------------------------------macro------------------------------------*/
+// Q16.16定点数：整数部分16位(含符号)，小数部分16位，分辨率约1.5e-5
+#define Q16_SHIFT 16
+#define Q16_ONE   ((q16_t) 1 << Q16_SHIFT)
+
+// 编译期常量转换(参数须为常量表达式，由编译器折叠；运行时的浮点值请用q16_from_float)
+#define Q16_FROM_FLOAT(x) ((q16_t) ((x) * 65536.0f + (((x) >= 0) ? 0.5f : -0.5f)))
+#define Q16_FROM_INT(x)   ((q16_t) (x) * Q16_ONE)
+#define Q16_TO_INT(x)     ((int32_t) (x) >> Q16_SHIFT)
+// 运行时转换到浮点(仅用于调试或与浮点接口衔接)
+#define Q16_TO_FLOAT(x)   ((float) (x) / 65536.0f)
+/*----------------------------------typedef-----------------------------------*/
+typedef int32_t q16_t;
+/*----------------------------------variable----------------------------------*/
+
+/*-------------------------------------os-------------------------------------*/
+
+/*----------------------------------function----------------------------------*/
+// Q16乘法：Cortex-M3上编译为一条SMULL加移位
+static inline q16_t q16_mul(q16_t a, q16_t b)
+{
+    return (q16_t) (((int64_t) a * b) >> Q16_SHIFT);
+}
+
+// 运行时浮点转换：一次软浮点乘法、加法和取整，超出Q16.16范围时饱和（仅用于与浮点接口衔接）
+static inline q16_t q16_from_float(float x)
+{
+    float scaled = x * 65536.0f;
+    if (scaled >= 2147483647.0f) return INT32_MAX;
+    if (scaled <= -2147483648.0f) return INT32_MIN;
+    return (q16_t) (scaled + ((scaled >= 0.0f) ? 0.5f : -0.5f));
+}
+
+// 饱和到[low, high]
+static inline q16_t q16_clamp(q16_t x, q16_t low, q16_t high)
+{
+    return (x > high) ? high : ((x < low) ? low : x);
+}
+/*------------------------------------test------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FIXED_H */
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+NTC ADC码-温度查找表生成器
+
+按Beta方程生成BSP/ntc_table.h中的标称查找表（每2^step_shift个ADC码一个节点，表项单位1/2^frac℃），
+并按固件的定点插值方法对全部过采样ADC码计算插值误差，报告有效测量范围内相对Beta方程的精度。
+表头中记录生成参数，ntc.c在参数与自身配置不一致时编译报错。
+
+用法：
+  python3 Tools/ntc_table_gen.py            生成BSP/ntc_table.h并打印精度报告
+  python3 Tools/ntc_table_gen.py --check    检查已提交的表头是否与当前参数一致（不写文件）
+  python3 Tools/ntc_table_gen.py --help     查看全部参数
+"""
+import argparse
+import math
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+KELVIN = 273.15
+T0 = 25.0 + KELVIN
+
+
+def nominal_temperature(code, args):
+    """ADC码（可带小数）对应的Beta方程温度（℃）"""
+    resistance = args.series * (args.adc_max / code - 1.0)
+    return 1.0 / (1.0 / T0 + math.log(resistance / args.r0) / args.beta) - KELVIN
+
+
+def build_table(args):
+    limit = 0x7FFF >> args.frac
+    size = (args.adc_max >> args.step_shift) + 2
+    table = []
+    for i in range(size):
+        code = i << args.step_shift
+        # ADC为0对应NTC开路（极冷端），满量程对应NTC短路（极热端）
+        if code == 0:
+            temperature = -limit
+        elif code >= args.adc_max:
+            temperature = limit
+        else:
+            temperature = min(max(nominal_temperature(code, args), -limit), limit)
+        table.append(int(math.floor(temperature * (1 << args.frac) + 0.5)))
+    return table
+
+
+def interpolate(table, code, args):
+    """与NTC_AdcToTemperature相同的定点插值（code带oversample位小数），返回Q16.16"""
+    shift = args.step_shift + args.oversample
+    index = code >> shift
+    frac = code & ((1 << shift) - 1)
+    lo = table[index]
+    diff = table[index + 1] - lo
+    return lo * (1 << (16 - args.frac)) + ((diff * frac << (16 - args.frac)) >> shift)
+
+
+def accuracy(table, args):
+    """有效范围内全部过采样码的插值误差：返回(最大误差, RMS, 最大误差处温度, 按10℃分段的最大误差)"""
+    scale = 1 << args.oversample
+    worst, worst_at, sum_sq, count = 0.0, 0.0, 0.0, 0
+    bands = {}
+    for code in range(1, args.adc_max * scale):
+        exact = nominal_temperature(code / scale, args)
+        if exact < args.temp_min or exact > args.temp_max:
+            continue
+        error = interpolate(table, code, args) / 65536.0 - exact
+        sum_sq += error * error
+        count += 1
+        if abs(error) > worst:
+            worst, worst_at = abs(error), exact
+        band = int(math.floor(exact / 10.0)) * 10
+        bands[band] = max(bands.get(band, 0.0), abs(error))
+    return worst, math.sqrt(sum_sq / count), worst_at, bands
+
+
+def render(table, args, worst, rms):
+    lines = [
+        "/**",
+        " * @file ntc_table.h",
+        " * @brief NTC标称查找表（由Tools/ntc_table_gen.py生成，勿手工修改）",
+        " *",
+        " * 节点为Beta方程在每%d个ADC码处的温度，单位1/%d℃；端点为开路/短路限值。" % (1 << args.step_shift, 1 << args.frac),
+        " * %d~%d℃内相对Beta方程的插值误差：最大%.4f℃，RMS %.4f℃（%d位过采样码逐一比对）"
+        % (args.temp_min, args.temp_max, worst, rms, args.oversample),
+        " */",
+        "#ifndef NTC_TABLE_H",
+        "#define NTC_TABLE_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "// 生成参数（ntc.c据此检查与自身配置一致）",
+        "#define NTC_TABLE_GEN_R0         %d" % args.r0,
+        "#define NTC_TABLE_GEN_BETA       %d" % args.beta,
+        "#define NTC_TABLE_GEN_SERIES     %d" % args.series,
+        "#define NTC_TABLE_GEN_ADC_MAX    %d" % args.adc_max,
+        "#define NTC_TABLE_GEN_STEP_SHIFT %d" % args.step_shift,
+        "#define NTC_TABLE_GEN_FRAC       %d" % args.frac,
+        "#define NTC_TABLE_GEN_SIZE       %d" % len(table),
+        "",
+        "static const int16_t ntc_nominal_table[NTC_TABLE_GEN_SIZE] = {",
+    ]
+    per_line = 12
+    for i in range(0, len(table), per_line):
+        lines.append("    " + " ".join("%6d," % v for v in table[i : i + per_line]))
+    lines += ["};", "", "#endif /* NTC_TABLE_H */", ""]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="生成NTC ADC码-温度查找表并报告插值精度")
+    parser.add_argument("--r0", type=int, default=10000, help="NTC标称电阻(Ω，25℃)")
+    parser.add_argument("--beta", type=int, default=3950, help="B常数")
+    parser.add_argument("--series", type=int, default=10000, help="串联电阻(Ω)")
+    parser.add_argument("--adc-max", type=int, default=4095, help="ADC满量程码")
+    parser.add_argument("--step-shift", type=int, default=5, help="节点间隔为2^N个ADC码")
+    parser.add_argument("--frac", type=int, default=7, help="表项小数位（1/2^N℃）")
+    parser.add_argument("--oversample", type=int, default=3, help="读取时过采样码的小数位")
+    parser.add_argument("--temp-min", type=int, default=-20, help="有效测量范围下限(℃)")
+    parser.add_argument("--temp-max", type=int, default=100, help="有效测量范围上限(℃)")
+    parser.add_argument("-o", "--output", default=os.path.join(ROOT, "BSP", "ntc_table.h"))
+    parser.add_argument("--check", action="store_true", help="只检查输出文件是否为最新")
+    args = parser.parse_args()
+
+    table = build_table(args)
+    worst, rms, worst_at, bands = accuracy(table, args)
+    text = render(table, args, worst, rms)
+
+    if args.check:
+        try:
+            with open(args.output, encoding="utf-8") as f:
+                current = f.read()
+        except OSError:
+            current = None
+        if current != text:
+            print("%s is out of date, run Tools/ntc_table_gen.py" % args.output)
+            return 1
+        print("%s is up to date (max error %.4f C, RMS %.4f C)" % (args.output, worst, rms))
+        return 0
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+    print("wrote %s (%d entries)" % (args.output, len(table)))
+    print("interpolation error vs. Beta equation, %d..%d C:" % (args.temp_min, args.temp_max))
+    print("  max %.4f C at %.1f C, RMS %.4f C" % (worst, worst_at, rms))
+    for band in sorted(bands):
+        print("  %4d..%4d C  max %.4f C" % (band, band + 10, bands[band]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
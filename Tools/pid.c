@@ -69,3 +69,158 @@ uint16_t PID(PID_Controller *pid, float input, float setpoint, uint16_t dt_ms)
 
     return (uint16_t) (output + 0.5f);
 }
+
+// 积分启用区间：与浮点版本一致，误差在±10℃以内才积分
+#define PID_INTEGRAL_BAND 10
+
+// 初始化定点PID控制器
+void PID_Q_Init(PID_Q_Controller *pid, q16_t Kp, q16_t Ki, q16_t Kd, q16_t max_integral, q16_t min_output,
+                q16_t max_output)
+{
+    pid->Kp = Kp;
+    pid->Ki = Ki;
+    pid->Kd = Kd;
+    pid->max_integral = max_integral;
+    pid->min_output = min_output;
+    pid->max_output = max_output;
+    pid->integral_band = Q16_FROM_INT(PID_INTEGRAL_BAND);
+    PID_Q_Reset(pid);
+}
+
+// 重置定点PID控制器
+void PID_Q_Reset(PID_Q_Controller *pid)
+{
+    pid->integral = 0;
+    pid->prev_input = 0;
+    pid->first_run = 1;
+}
+
+// 定点PID计算函数：全程整数运算，乘法为64位SMULL，除法仅两次32位硬件除法
+q16_t PID_Q(PID_Q_Controller *pid, q16_t input, q16_t setpoint, uint16_t dt_ms)
+{
+    if (dt_ms == 0) dt_ms = 1;
+
+    q16_t error = setpoint - input;
+    q16_t dt_sec = (q16_t) (((uint32_t) dt_ms << Q16_SHIFT) / 1000U);
+    q16_t inv_dt = (q16_t) ((1000U << Q16_SHIFT) / dt_ms);
+
+    // 比例项
+    q16_t P = q16_mul(pid->Kp, error);
+
+    // 积分项
+    q16_t abs_error = (error < 0) ? -error : error;
+    if (abs_error < pid->integral_band) // 只在误差较小时启用积分
+    {
+        pid->integral += q16_mul(q16_mul(pid->Ki, error), dt_sec);
+    }
+    else
+    {
+        pid->integral = 0; // 误差过大时清空积分
+    }
+    // 积分限幅
+    pid->integral = q16_clamp(pid->integral, -pid->max_integral, pid->max_integral);
+
+    // 微分项(对测量值微分，避免设定值突变引起的冲击)
+    q16_t D = 0;
+    if (!pid->first_run)
+    {
+        q16_t input_derivative = q16_mul(input - pid->prev_input, inv_dt);
+        D = -q16_mul(pid->Kd, input_derivative);
+    }
+    else
+    {
+        pid->first_run = 0;
+    }
+    pid->prev_input = input;
+
+    // 计算输出
+    return q16_clamp(P + pid->integral + D, pid->min_output, pid->max_output);
+}
+
+// 自整定参数：首个周期为升温过程不计入，其后取PID_TUNE_CYCLES个周期平均
+#define PID_TUNE_CYCLES     3
+#define PID_TUNE_TIMEOUT_MS (60UL * 60UL * 1000UL) // 整定超时（60分钟）
+#define PID_TUNE_OVER_TEMP  10                     // 超过设定值该温度即中止（℃）
+#define Q16_PI              205887                 // π的Q16.16表示
+
+// 初始化继电反馈自整定器
+void PID_Tune_Init(PID_Tuner *tuner, q16_t setpoint, q16_t hysteresis, q16_t output_low, q16_t output_high)
+{
+    tuner->setpoint = setpoint;
+    tuner->hysteresis = hysteresis;
+    tuner->output_low = output_low;
+    tuner->output_high = output_high;
+    tuner->peak_max = INT32_MIN;
+    tuner->peak_min = INT32_MAX;
+    tuner->amp_sum = 0;
+    tuner->elapsed_ms = 0;
+    tuner->last_rise_ms = 0;
+    tuner->period_sum_ms = 0;
+    tuner->relay_high = 1;
+    tuner->rises = 0;
+    tuner->Ku = 0;
+    tuner->Tu_ms = 0;
+}
+
+// 自整定单步：返回本周期的继电输出，state返回整定状态
+q16_t PID_Tune_Step(PID_Tuner *tuner, q16_t input, uint16_t dt_ms, PID_TuneState *state)
+{
+    tuner->elapsed_ms += dt_ms;
+    *state = PID_TUNE_RUNNING;
+
+    if (tuner->elapsed_ms > PID_TUNE_TIMEOUT_MS || input > tuner->setpoint + Q16_FROM_INT(PID_TUNE_OVER_TEMP))
+    {
+        *state = PID_TUNE_FAILED;
+        return tuner->output_low;
+    }
+
+    if (input > tuner->peak_max) tuner->peak_max = input;
+    if (input < tuner->peak_min) tuner->peak_min = input;
+
+    if (tuner->relay_high && input > tuner->setpoint + tuner->hysteresis)
+    {
+        tuner->relay_high = 0;
+    }
+    else if (!tuner->relay_high && input < tuner->setpoint - tuner->hysteresis)
+    {
+        // 继电切换为高：一个完整振荡周期结束（从上次切换为高到本次）
+        tuner->relay_high = 1;
+        tuner->rises++;
+        if (tuner->rises >= 2)
+        {
+            tuner->period_sum_ms += tuner->elapsed_ms - tuner->last_rise_ms;
+            tuner->amp_sum += tuner->peak_max - tuner->peak_min;
+        }
+        tuner->last_rise_ms = tuner->elapsed_ms;
+        tuner->peak_max = INT32_MIN;
+        tuner->peak_min = INT32_MAX;
+
+        if (tuner->rises > PID_TUNE_CYCLES)
+        {
+            // 振荡幅值a为峰峰值的一半，继电幅值d为输出差的一半：Ku = 4d / (πa) = 4(high-low) / (π·峰峰值)
+            q16_t pp = tuner->amp_sum / PID_TUNE_CYCLES;
+            if (pp <= 0)
+            {
+                *state = PID_TUNE_FAILED;
+                return tuner->output_low;
+            }
+            int64_t relay = (int64_t) (tuner->output_high - tuner->output_low) * 4;
+            tuner->Ku = (q16_t) ((relay << Q16_SHIFT) / q16_mul(Q16_PI, pp));
+            tuner->Tu_ms = tuner->period_sum_ms / PID_TUNE_CYCLES;
+            *state = PID_TUNE_DONE;
+            return tuner->output_low;
+        }
+    }
+
+    return tuner->relay_high ? tuner->output_high : tuner->output_low;
+}
+
+// 由Ku/Tu计算PID增益：采用Ziegler-Nichols"无超调"整定规则
+// Kp = 0.2Ku，Ti = Tu/2，Td = Tu/3，即Ki = Kp/Ti = 0.4Ku/Tu，Kd = Kp·Td = Ku·Tu/15
+void PID_Tune_Gains(q16_t Ku, uint32_t Tu_ms, q16_t *Kp, q16_t *Ki, q16_t *Kd)
+{
+    if (Tu_ms == 0) Tu_ms = 1;
+    *Kp = Ku / 5;
+    *Ki = (q16_t) ((int64_t) Ku * 400 / Tu_ms);
+    *Kd = (q16_t) ((int64_t) Ku * Tu_ms / 15000);
+}
@@ -2,6 +2,7 @@
 #ifndef __PID_H
 #define __PID_H
 
+#include "fixed.h"
 #include "main.h"
 
 // PID控制器结构体
@@ -19,9 +20,61 @@ typedef struct
     uint8_t first_run;    // 首次运行标志
 } PID_Controller;
 
+// 定点PID控制器结构体(Q16.16，行为与浮点版本一致：条件积分、积分限幅、测量值微分)
+typedef struct
+{
+    q16_t   Kp;            // 比例增益
+    q16_t   Ki;            // 积分增益(每秒)
+    q16_t   Kd;            // 微分增益(秒)
+    q16_t   integral;      // 积分累积值
+    q16_t   max_integral;  // 积分限幅值
+    q16_t   min_output;    // 最小输出值
+    q16_t   max_output;    // 最大输出值
+    q16_t   integral_band; // 误差小于该值时才积分
+    q16_t   prev_input;    // 前一次输入值（用于微分项）
+    uint8_t first_run;     // 首次运行标志
+} PID_Q_Controller;
+
+// 继电反馈自整定状态
+typedef enum
+{
+    PID_TUNE_RUNNING = 0, // 整定进行中
+    PID_TUNE_DONE,        // 整定完成，Ku/Tu有效
+    PID_TUNE_FAILED       // 整定失败（超时、超温或振荡幅值无效）
+} PID_TuneState;
+
+// 继电反馈自整定器(Astrom-Hagglund)：输入低于设定值-回差时输出高，高于设定值+回差时输出低，
+// 由稳定振荡的幅值与周期求临界增益Ku与临界周期Tu
+typedef struct
+{
+    q16_t    setpoint;      // 整定设定值
+    q16_t    hysteresis;    // 继电回差（抑制噪声引起的抖动）
+    q16_t    output_low;    // 继电低输出
+    q16_t    output_high;   // 继电高输出
+    q16_t    peak_max;      // 本周期输入最大值
+    q16_t    peak_min;      // 本周期输入最小值
+    q16_t    amp_sum;       // 已测周期的峰峰值累加
+    uint32_t elapsed_ms;    // 整定已用时间
+    uint32_t last_rise_ms;  // 上次继电切换为高的时刻
+    uint32_t period_sum_ms; // 已测周期的周期累加
+    uint8_t  relay_high;    // 当前继电输出状态
+    uint8_t  rises;         // 继电切换为高的次数
+    q16_t    Ku;            // 临界增益（整定完成后有效）
+    uint32_t Tu_ms;         // 临界周期（毫秒，整定完成后有效）
+} PID_Tuner;
+
 void     PID_Init(PID_Controller *pid, float Kp, float Ki, float Kd, float max_integral, float min_output,
                   float max_output);
 void     PID_Reset(PID_Controller *pid);
 uint16_t PID(PID_Controller *pid, float input_temp, float target_temp, uint16_t dt_ms);
 
+void  PID_Q_Init(PID_Q_Controller *pid, q16_t Kp, q16_t Ki, q16_t Kd, q16_t max_integral, q16_t min_output,
+                 q16_t max_output);
+void  PID_Q_Reset(PID_Q_Controller *pid);
+q16_t PID_Q(PID_Q_Controller *pid, q16_t input, q16_t setpoint, uint16_t dt_ms);
+
+void  PID_Tune_Init(PID_Tuner *tuner, q16_t setpoint, q16_t hysteresis, q16_t output_low, q16_t output_high);
+q16_t PID_Tune_Step(PID_Tuner *tuner, q16_t input, uint16_t dt_ms, PID_TuneState *state);
+void  PID_Tune_Gains(q16_t Ku, uint32_t Tu_ms, q16_t *Kp, q16_t *Ki, q16_t *Kd);
+
 #endif
@@ -0,0 +1,197 @@
+/**
+ * @file thermal_model.c
+ * @brief 加热片一阶热模型在线辨识
+ *
+ * 以1秒为窗口取温度变化率和平均占空比，用带遗忘因子的递推最小二乘
+ * 辨识 dT/dt = -a·T + b·u + c 的三个参数。线性环节可交换次序，
+ * 因此先将占空比经过传感器滞后再参与辨识，即可直接用测量温度辨识
+ * 加热片模型，无需对测量值求导还原。辨识每秒仅一次3阶矩阵运算，
+ * 参数动态范围大，使用浮点；辨识后把参数换算为定点系数，每个控制周期的
+ * 状态推进、Smith预估补偿和前馈只做几次定点乘加，不再调用软浮点库。
+ */
+#include "thermal_model.h"
+
+#define MODEL_WINDOW_MS     1000    // 辨识窗口长度
+#define MODEL_LAMBDA        0.998f  // 遗忘因子（等效记忆约500秒）
+#define MODEL_P_INIT        1000.0f // 协方差初值
+#define MODEL_P_MAX         1.0e4f  // 协方差上限：激励不足时停止遗忘，防止协方差发散
+#define MODEL_MIN_SAMPLES   120     // 至少辨识2分钟后才启用
+#define MODEL_TAU_MIN_S     5.0f    // 有效时间常数下限
+#define MODEL_TAU_MAX_S     3600.0f // 有效时间常数上限
+#define MODEL_PRIOR_TAU_S   300.0f  // 先验时间常数
+#define MODEL_PRIOR_GAIN    0.3f    // 先验稳态增益（℃/%）
+#define MODEL_PRIOR_AMBIENT 25.0f   // 先验环境温度（℃）
+#define MODEL_COEF_SHIFT    24      // 模型系数定点小数位（a在1/3600量级，Q16精度不足）
+
+// 浮点转Q8.24系数（饱和）
+static int32_t thermal_model_coef(float x)
+{
+    float scaled = x * (float) (1UL << MODEL_COEF_SHIFT);
+    if (scaled >= 2147483647.0f) return INT32_MAX;
+    if (scaled <= -2147483648.0f) return INT32_MIN;
+    return (int32_t) scaled;
+}
+
+// Q8.24系数乘Q16.16值，结果为Q16.16
+static inline q16_t thermal_model_coef_mul(int32_t coef, q16_t x)
+{
+    return (q16_t) (((int64_t) coef * x) >> MODEL_COEF_SHIFT);
+}
+
+// 辨识后更新有效标志与定点系数（每秒至多一次）
+static void thermal_model_coef_update(ThermalModel *m)
+{
+    m->valid = m->samples >= MODEL_MIN_SAMPLES && m->theta[0] > 1.0f / MODEL_TAU_MAX_S &&
+               m->theta[0] < 1.0f / MODEL_TAU_MIN_S && m->theta[1] > 0.0f;
+    if (!m->valid) return;
+
+    for (uint8_t i = 0; i < 3; i++) { m->coef[i] = thermal_model_coef(m->theta[i]); }
+    m->ff_gain = q16_from_float(m->theta[0] / m->theta[1]);
+    m->ff_offset = q16_from_float(m->theta[2] / m->theta[1]);
+}
+
+// 控制周期变化时重新计算离散系数（周期只在100ms与1s之间切换）
+static void thermal_model_set_period(ThermalModel *m, uint16_t dt_ms)
+{
+    if (dt_ms == m->dt_ms) return;
+
+    float dt = dt_ms / 1000.0f;
+    m->dt = q16_from_float(dt);
+    m->lag_alpha = q16_from_float(dt / (m->sensor_lag_s + dt));
+    m->dt_ms = dt_ms;
+}
+
+// 协方差置为初值
+static void thermal_model_p_reset(ThermalModel *m)
+{
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        for (uint8_t j = 0; j < 3; j++) { m->P[i][j] = (i == j) ? MODEL_P_INIT : 0.0f; }
+    }
+}
+
+void thermal_model_init(ThermalModel *m, float sensor_lag_s)
+{
+    m->theta[0] = 1.0f / MODEL_PRIOR_TAU_S;
+    m->theta[1] = MODEL_PRIOR_GAIN / MODEL_PRIOR_TAU_S;
+    m->theta[2] = MODEL_PRIOR_AMBIENT / MODEL_PRIOR_TAU_S;
+    thermal_model_p_reset(m);
+    m->sensor_lag_s = sensor_lag_s;
+    m->dt_ms = 0;
+    m->samples = 0;
+    thermal_model_coef_update(m);
+    thermal_model_restart(m, Q16_FROM_INT(MODEL_PRIOR_AMBIENT));
+}
+
+void thermal_model_restart(ThermalModel *m, q16_t temp)
+{
+    m->pad = temp;
+    m->sensor = temp;
+    m->duty_lag = 0;
+    m->win_temp = temp;
+    m->win_duty_sum = 0;
+    m->win_ms = 0;
+    m->win_valid = 0;
+}
+
+// 递推最小二乘：phi = [-T, u, 1]，y = dT/dt
+static void thermal_model_rls(ThermalModel *m, const float phi[3], float y)
+{
+    // 协方差过大说明激励不足（稳态），此时不再遗忘
+    float lambda = (m->P[0][0] + m->P[1][1] + m->P[2][2] > MODEL_P_MAX) ? 1.0f : MODEL_LAMBDA;
+    float Pphi[3];
+    float denom = lambda;
+    float err = y;
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        Pphi[i] = m->P[i][0] * phi[0] + m->P[i][1] * phi[1] + m->P[i][2] * phi[2];
+        denom += phi[i] * Pphi[i];
+        err -= phi[i] * m->theta[i];
+    }
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        float k = Pphi[i] / denom;
+        m->theta[i] += k * err;
+        for (uint8_t j = 0; j < 3; j++) { m->P[i][j] = (m->P[i][j] - k * Pphi[j]) / lambda; }
+    }
+
+    // 温度项与常数项强相关，单精度下协方差会逐渐失去对称正定性并导致参数发散：
+    // 每次更新后强制对称，对角元非正时重置协方差（保留参数，重新收敛）
+    uint8_t reset = 0;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        if (!(m->P[i][i] > 0.0f)) reset = 1;
+        for (uint8_t j = i + 1; j < 3; j++) { m->P[i][j] = m->P[j][i] = (m->P[i][j] + m->P[j][i]) * 0.5f; }
+    }
+    if (reset) thermal_model_p_reset(m);
+    m->samples++;
+    thermal_model_coef_update(m);
+}
+
+void thermal_model_update(ThermalModel *m, q16_t temp, q16_t duty, uint16_t dt_ms)
+{
+    thermal_model_set_period(m, dt_ms);
+
+    // 占空比经过传感器滞后，与测量温度对齐
+    m->duty_lag += q16_mul(duty - m->duty_lag, m->lag_alpha);
+
+    // 推进模型状态：加热片温度按辨识模型，传感器温度按一阶滞后跟随加热片
+    if (m->valid)
+    {
+        q16_t rate = (m->coef[2] >> (MODEL_COEF_SHIFT - Q16_SHIFT)) + thermal_model_coef_mul(m->coef[1], duty) -
+                     thermal_model_coef_mul(m->coef[0], m->pad);
+        m->pad += q16_mul(rate, m->dt);
+        m->sensor += q16_mul(m->pad - m->sensor, m->lag_alpha);
+    }
+    else
+    {
+        m->pad = temp;
+        m->sensor = temp;
+    }
+
+    // 累计辨识窗口，窗口满时以平均变化率更新参数
+    if (!m->win_valid)
+    {
+        m->win_temp = temp;
+        m->win_duty_sum = 0;
+        m->win_ms = 0;
+        m->win_valid = 1;
+        return;
+    }
+    m->win_duty_sum += (int64_t) m->duty_lag * dt_ms;
+    m->win_ms += dt_ms;
+    if (m->win_ms < MODEL_WINDOW_MS) return;
+
+    // 窗口满：换算为浮点后辨识（每秒一次）
+    float win_s = m->win_ms / 1000.0f;
+    float phi[3] = {-Q16_TO_FLOAT(m->win_temp + temp) * 0.5f, (float) m->win_duty_sum / (65536.0f * m->win_ms), 1.0f};
+    thermal_model_rls(m, phi, Q16_TO_FLOAT(temp - m->win_temp) / win_s);
+
+    m->win_temp = temp;
+    m->win_duty_sum = 0;
+    m->win_ms = 0;
+}
+
+uint8_t thermal_model_valid(const ThermalModel *m)
+{
+    return m->valid;
+}
+
+q16_t thermal_model_feedforward(const ThermalModel *m, q16_t setpoint)
+{
+    if (!m->valid) return 0;
+
+    // 稳态时 dT/dt = 0：u = (a·T - c) / b = (a/b)·T - c/b
+    int64_t duty = (((int64_t) m->ff_gain * setpoint) >> Q16_SHIFT) - m->ff_offset;
+    if (duty < 0) duty = 0;
+    if (duty > Q16_FROM_INT(100)) duty = Q16_FROM_INT(100);
+    return (q16_t) duty;
+}
+
+q16_t thermal_model_compensate(const ThermalModel *m, q16_t measured)
+{
+    if (!m->valid) return measured;
+    return measured + (m->pad - m->sensor);
+}
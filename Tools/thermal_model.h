@@ -0,0 +1,83 @@
+#ifndef THERMAL_MODEL_H
+#define THERMAL_MODEL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*----------------------------------include-----------------------------------*/
+#include "fixed.h"
+#include <stdint.h>
+/*-----------------------------------macro------------------------------------*/
+
+/*----------------------------------typedef-----------------------------------*/
+// 一阶热模型：dT/dt = -a·T + b·u + c（a = 1/τ，b = K/τ，c = T环境/τ，u为占空比%）
+// 参数由递推最小二乘在线辨识（浮点，每秒一次）；另以一阶惯性环节描述NTC相对加热片的测量滞后。
+// 每个控制周期的状态推进、预估补偿与前馈只使用辨识后换算好的定点系数
+typedef struct
+{
+    float    theta[3];      // 模型参数 a, b, c
+    float    P[3][3];       // RLS协方差矩阵
+    float    sensor_lag_s;  // 传感器滞后时间常数（秒）
+    int32_t  coef[3];       // 模型参数 a, b, c 的定点值（Q8.24，辨识后更新）
+    q16_t    ff_gain;       // 前馈斜率 a/b（%/℃）
+    q16_t    ff_offset;     // 前馈截距 c/b（%）
+    q16_t    lag_alpha;     // 当前周期下传感器滞后的离散系数 dt/(滞后+dt)
+    q16_t    dt;            // 当前周期（秒，Q16.16）
+    uint16_t dt_ms;         // lag_alpha与dt对应的周期
+    q16_t    pad;           // 模型加热片温度（无测量滞后）
+    q16_t    sensor;        // 模型传感器温度（含测量滞后）
+    q16_t    duty_lag;      // 经传感器滞后后的占空比（用于辨识）
+    q16_t    win_temp;      // 辨识窗口起点温度
+    int64_t  win_duty_sum;  // 辨识窗口内滞后占空比·时间累加（Q16.16 %·ms）
+    uint32_t win_ms;        // 辨识窗口已累计时间
+    uint32_t samples;       // 已参与辨识的样本数
+    uint8_t  win_valid;     // 辨识窗口起点是否有效
+    uint8_t  valid;         // 参数是否已收敛（辨识后更新）
+} ThermalModel;
+/*----------------------------------variable----------------------------------*/
+
+/*-------------------------------------os-------------------------------------*/
+
+/*----------------------------------function----------------------------------*/
+/**
+ * @brief 初始化热模型（参数取先验值，需在线辨识后才有效）
+ * @param sensor_lag_s NTC相对加热片的滞后时间常数（秒）
+ */
+void thermal_model_init(ThermalModel *m, float sensor_lag_s);
+
+/**
+ * @brief 以当前测量温度重置模型状态并重新开始辨识窗口（加热启动时调用，保留已辨识参数）
+ */
+void thermal_model_restart(ThermalModel *m, q16_t temp);
+
+/**
+ * @brief 输入一个控制周期的数据：推进模型状态，辨识窗口满时更新一次参数
+ * @param temp 本周期测量温度（℃）
+ * @param duty 上一周期施加的占空比（%）
+ * @param dt_ms 距上一周期的时间
+ */
+void thermal_model_update(ThermalModel *m, q16_t temp, q16_t duty, uint16_t dt_ms);
+
+/**
+ * @brief 模型是否已收敛到可用于前馈与预估补偿
+ */
+uint8_t thermal_model_valid(const ThermalModel *m);
+
+/**
+ * @brief 维持设定温度所需的稳态占空比（%，前馈量）
+ */
+q16_t thermal_model_feedforward(const ThermalModel *m, q16_t setpoint);
+
+/**
+ * @brief Smith预估补偿：测量值加上模型中无滞后与有滞后温度之差，作为反馈量
+ */
+q16_t thermal_model_compensate(const ThermalModel *m, q16_t measured);
+/*------------------------------------test------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THERMAL_MODEL_H */
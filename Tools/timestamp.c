@@ -0,0 +1,107 @@
+/**
+ * @file timestamp.c
+ * @brief 统一时间戳服务
+ *
+ * DWT->CYCCNT提供周期级分辨率但32位计数在64MHz下约67秒回绕，
+ * RTC计数器与UTC对齐但只有1秒分辨率。每个RTC秒中断时将周期计数
+ * 折算进64位微秒累加器并记录UTC锚点，读取时只需一次CYCCNT读取和
+ * 一次整数除法，不访问APB1上的RTC寄存器，可在中断中调用。
+ * 依赖RTC秒中断持续运行，否则CYCCNT回绕后单调时间将失真。
+ */
+#include "timestamp.h"
+#include "main.h"
+#include "rtc.h"
+
+#define TS_SUB_SECOND_MAX_US 999999U // UTC时间戳秒内部分上限
+
+// 时间基准(仅在RTC秒中断中关中断更新)
+static volatile uint32_t ts_seq = 0;
+static volatile uint64_t ts_mono_base_us = 0;   // 上次折算时的单调微秒数
+static volatile uint32_t ts_base_cycles = 0;    // 上次折算时的CYCCNT(已扣除不足1us的余数)
+static volatile uint64_t ts_utc_anchor_us = 0;  // 最近一个RTC秒边沿的UTC微秒数
+static volatile uint64_t ts_mono_anchor_us = 0; // 同一秒边沿对应的单调微秒数
+static uint32_t          ts_cycles_per_us = 1;
+
+// 内部函数：把自上次折算以来的周期数累加到单调时间(调用方需关中断)
+static void timestamp_fold(void)
+{
+    uint32_t elapsed = DWT->CYCCNT - ts_base_cycles;
+    uint32_t us = elapsed / ts_cycles_per_us;
+
+    ts_mono_base_us += us;
+    ts_base_cycles += us * ts_cycles_per_us; // 余数留到下次，避免累计误差
+}
+
+// RTC秒边沿回调(秒中断上下文)：折算周期计数并更新UTC锚点
+static void timestamp_second_tick(const RTC_DateTimeTypeDef *now)
+{
+    uint32_t utc = RTC_DateTimeToUTC((RTC_DateTimeTypeDef *) now);
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    ts_seq++;
+    timestamp_fold();
+    ts_utc_anchor_us = (uint64_t) utc * 1000000U;
+    ts_mono_anchor_us = ts_mono_base_us;
+    ts_seq++;
+    __set_PRIMASK(primask);
+}
+
+void timestamp_init(void)
+{
+    ts_cycles_per_us = SystemCoreClock / 1000000U;
+    if (ts_cycles_per_us == 0) ts_cycles_per_us = 1;
+
+    // 使能DWT周期计数器
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // 以当前秒内位置作为初始锚点
+    uint32_t sub_us;
+    uint32_t utc = RTC_GetUTCSubSecond(&sub_us);
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    ts_base_cycles = DWT->CYCCNT;
+    ts_mono_base_us = 0;
+    ts_utc_anchor_us = (uint64_t) utc * 1000000U + sub_us;
+    ts_mono_anchor_us = 0;
+    __set_PRIMASK(primask);
+
+    RTC_RegisterTickCallback(RTC_EDGE_SECOND, timestamp_second_tick);
+}
+
+uint64_t timestamp_mono_us(void)
+{
+    uint32_t seq;
+    uint64_t base;
+    uint32_t cycles;
+
+    do
+    {
+        seq = ts_seq;
+        base = ts_mono_base_us;
+        cycles = ts_base_cycles;
+    } while (seq != ts_seq);
+
+    return base + (DWT->CYCCNT - cycles) / ts_cycles_per_us;
+}
+
+uint64_t timestamp_utc_us(void)
+{
+    uint32_t seq;
+    uint64_t utc_anchor, mono_anchor;
+
+    do
+    {
+        seq = ts_seq;
+        utc_anchor = ts_utc_anchor_us;
+        mono_anchor = ts_mono_anchor_us;
+    } while (seq != ts_seq);
+
+    // 秒中断被延迟时插值可能超过1秒，下一次锚点会回到更早的时刻；停在本秒末，保证不倒退
+    uint64_t offset = timestamp_mono_us() - mono_anchor;
+    if (offset > TS_SUB_SECOND_MAX_US) offset = TS_SUB_SECOND_MAX_US;
+    return utc_anchor + offset;
+}
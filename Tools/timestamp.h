@@ -0,0 +1,43 @@
+#ifndef TIMESTAMP_H
+#define TIMESTAMP_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*----------------------------------include-----------------------------------*/
+#include <stdint.h>
+/*-----------------------------------macro------------------------------------*/
+
+/*----------------------------------typedef-----------------------------------*/
+
+/*----------------------------------variable----------------------------------*/
+
+/*-------------------------------------os-------------------------------------*/
+
+/*----------------------------------function----------------------------------*/
+/**
+ * @brief 初始化统一时间戳服务(DWT周期计数器 + RTC秒边沿对齐)
+ * @note 需在RTC_Init之后调用
+ */
+void timestamp_init(void);
+
+/**
+ * @brief 获取单调递增的微秒时间戳(自timestamp_init起)
+ * @note 不受UTC校时影响，可在任务和中断中调用
+ */
+uint64_t timestamp_mono_us(void);
+
+/**
+ * @brief 获取对齐UTC的微秒时间戳(自1970-01-01起)
+ * @note 秒部分来自RTC计数器，秒内部分由DWT插值(不超过本秒末，保证不倒退)，可在任务和中断中调用
+ */
+uint64_t timestamp_utc_us(void);
+/*------------------------------------test------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMESTAMP_H */
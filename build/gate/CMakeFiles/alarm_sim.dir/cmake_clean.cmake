@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alarm_sim.dir/alarm_sim.c.o"
+  "CMakeFiles/alarm_sim.dir/alarm_sim.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/BSP/heat.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/BSP/heat.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/BSP/ntc.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/BSP/ntc.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/Core/Src/rtc.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/Core/Src/rtc.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/Task/alarm.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/Task/alarm.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_ctrl.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_ctrl.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_profile.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_profile.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_stats.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_stats.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_task.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_task.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/Tools/filter.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/Tools/filter.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/Tools/pid.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/Tools/pid.c.o.d"
+  "CMakeFiles/alarm_sim.dir/root/repo/Tools/thermal_model.c.o"
+  "CMakeFiles/alarm_sim.dir/root/repo/Tools/thermal_model.c.o.d"
+  "alarm_sim"
+  "alarm_sim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/alarm_sim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
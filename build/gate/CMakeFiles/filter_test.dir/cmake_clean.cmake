@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/filter_test.dir/filter_test.c.o"
+  "CMakeFiles/filter_test.dir/filter_test.c.o.d"
+  "CMakeFiles/filter_test.dir/root/repo/Tools/filter.c.o"
+  "CMakeFiles/filter_test.dir/root/repo/Tools/filter.c.o.d"
+  "filter_test"
+  "filter_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/filter_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
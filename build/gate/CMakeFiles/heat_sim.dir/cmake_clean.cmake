@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/heat_sim.dir/heat_sim.c.o"
+  "CMakeFiles/heat_sim.dir/heat_sim.c.o.d"
+  "CMakeFiles/heat_sim.dir/root/repo/BSP/heat.c.o"
+  "CMakeFiles/heat_sim.dir/root/repo/BSP/heat.c.o.d"
+  "CMakeFiles/heat_sim.dir/root/repo/BSP/ntc.c.o"
+  "CMakeFiles/heat_sim.dir/root/repo/BSP/ntc.c.o.d"
+  "CMakeFiles/heat_sim.dir/root/repo/Core/Src/rtc.c.o"
+  "CMakeFiles/heat_sim.dir/root/repo/Core/Src/rtc.c.o.d"
+  "CMakeFiles/heat_sim.dir/root/repo/Task/heat_ctrl.c.o"
+  "CMakeFiles/heat_sim.dir/root/repo/Task/heat_ctrl.c.o.d"
+  "CMakeFiles/heat_sim.dir/root/repo/Task/heat_profile.c.o"
+  "CMakeFiles/heat_sim.dir/root/repo/Task/heat_profile.c.o.d"
+  "CMakeFiles/heat_sim.dir/root/repo/Task/heat_stats.c.o"
+  "CMakeFiles/heat_sim.dir/root/repo/Task/heat_stats.c.o.d"
+  "CMakeFiles/heat_sim.dir/root/repo/Task/heat_task.c.o"
+  "CMakeFiles/heat_sim.dir/root/repo/Task/heat_task.c.o.d"
+  "CMakeFiles/heat_sim.dir/root/repo/Tools/filter.c.o"
+  "CMakeFiles/heat_sim.dir/root/repo/Tools/filter.c.o.d"
+  "CMakeFiles/heat_sim.dir/root/repo/Tools/pid.c.o"
+  "CMakeFiles/heat_sim.dir/root/repo/Tools/pid.c.o.d"
+  "CMakeFiles/heat_sim.dir/root/repo/Tools/thermal_model.c.o"
+  "CMakeFiles/heat_sim.dir/root/repo/Tools/thermal_model.c.o.d"
+  "heat_sim"
+  "heat_sim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/heat_sim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/host.dir/Host/host_flash.c.o"
+  "CMakeFiles/host.dir/Host/host_flash.c.o.d"
+  "CMakeFiles/host.dir/Host/host_hal.c.o"
+  "CMakeFiles/host.dir/Host/host_hal.c.o.d"
+  "CMakeFiles/host.dir/Host/host_rtos.c.o"
+  "CMakeFiles/host.dir/Host/host_rtos.c.o.d"
+  "CMakeFiles/host.dir/root/repo/Core/Src/stm32f1xx_it.c.o"
+  "CMakeFiles/host.dir/root/repo/Core/Src/stm32f1xx_it.c.o.d"
+  "libhost.a"
+  "libhost.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/host.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pid_q_test.dir/pid_q_test.c.o"
+  "CMakeFiles/pid_q_test.dir/pid_q_test.c.o.d"
+  "CMakeFiles/pid_q_test.dir/root/repo/Tools/pid.c.o"
+  "CMakeFiles/pid_q_test.dir/root/repo/Tools/pid.c.o.d"
+  "pid_q_test"
+  "pid_q_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pid_q_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/thermal_model_test.dir/root/repo/Tools/thermal_model.c.o"
+  "CMakeFiles/thermal_model_test.dir/root/repo/Tools/thermal_model.c.o.d"
+  "CMakeFiles/thermal_model_test.dir/thermal_model_test.c.o"
+  "CMakeFiles/thermal_model_test.dir/thermal_model_test.c.o.d"
+  "thermal_model_test"
+  "thermal_model_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/thermal_model_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Core/Src/rtc.c" "CMakeFiles/timestamp_test.dir/root/repo/Core/Src/rtc.c.o" "gcc" "CMakeFiles/timestamp_test.dir/root/repo/Core/Src/rtc.c.o.d"
+  "/root/repo/Tools/timestamp.c" "CMakeFiles/timestamp_test.dir/root/repo/Tools/timestamp.c.o" "gcc" "CMakeFiles/timestamp_test.dir/root/repo/Tools/timestamp.c.o.d"
+  "/root/repo/Test/timestamp_test.c" "CMakeFiles/timestamp_test.dir/timestamp_test.c.o" "gcc" "CMakeFiles/timestamp_test.dir/timestamp_test.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/gate/CMakeFiles/host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timestamp_test.dir/root/repo/Core/Src/rtc.c.o"
+  "CMakeFiles/timestamp_test.dir/root/repo/Core/Src/rtc.c.o.d"
+  "CMakeFiles/timestamp_test.dir/root/repo/Tools/timestamp.c.o"
+  "CMakeFiles/timestamp_test.dir/root/repo/Tools/timestamp.c.o.d"
+  "CMakeFiles/timestamp_test.dir/timestamp_test.c.o"
+  "CMakeFiles/timestamp_test.dir/timestamp_test.c.o.d"
+  "timestamp_test"
+  "timestamp_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/timestamp_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Test/alarm_sim.c" "CMakeFiles/alarm_sim.dir/alarm_sim.c.o" "gcc" "CMakeFiles/alarm_sim.dir/alarm_sim.c.o.d"
+  "/root/repo/BSP/heat.c" "CMakeFiles/alarm_sim.dir/root/repo/BSP/heat.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/BSP/heat.c.o.d"
+  "/root/repo/BSP/ntc.c" "CMakeFiles/alarm_sim.dir/root/repo/BSP/ntc.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/BSP/ntc.c.o.d"
+  "/root/repo/Core/Src/rtc.c" "CMakeFiles/alarm_sim.dir/root/repo/Core/Src/rtc.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/Core/Src/rtc.c.o.d"
+  "/root/repo/Task/alarm.c" "CMakeFiles/alarm_sim.dir/root/repo/Task/alarm.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/Task/alarm.c.o.d"
+  "/root/repo/Task/heat_ctrl.c" "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_ctrl.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_ctrl.c.o.d"
+  "/root/repo/Task/heat_profile.c" "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_profile.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_profile.c.o.d"
+  "/root/repo/Task/heat_stats.c" "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_stats.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_stats.c.o.d"
+  "/root/repo/Task/heat_task.c" "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_task.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/Task/heat_task.c.o.d"
+  "/root/repo/Tools/filter.c" "CMakeFiles/alarm_sim.dir/root/repo/Tools/filter.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/Tools/filter.c.o.d"
+  "/root/repo/Tools/pid.c" "CMakeFiles/alarm_sim.dir/root/repo/Tools/pid.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/Tools/pid.c.o.d"
+  "/root/repo/Tools/thermal_model.c" "CMakeFiles/alarm_sim.dir/root/repo/Tools/thermal_model.c.o" "gcc" "CMakeFiles/alarm_sim.dir/root/repo/Tools/thermal_model.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/test/CMakeFiles/host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Test/Host/host_flash.c" "CMakeFiles/host.dir/Host/host_flash.c.o" "gcc" "CMakeFiles/host.dir/Host/host_flash.c.o.d"
+  "/root/repo/Test/Host/host_hal.c" "CMakeFiles/host.dir/Host/host_hal.c.o" "gcc" "CMakeFiles/host.dir/Host/host_hal.c.o.d"
+  "/root/repo/Test/Host/host_rtos.c" "CMakeFiles/host.dir/Host/host_rtos.c.o" "gcc" "CMakeFiles/host.dir/Host/host_rtos.c.o.d"
+  "/root/repo/Core/Src/stm32f1xx_it.c" "CMakeFiles/host.dir/root/repo/Core/Src/stm32f1xx_it.c.o" "gcc" "CMakeFiles/host.dir/root/repo/Core/Src/stm32f1xx_it.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Test/ntc_table_test.c" "CMakeFiles/ntc_table_test.dir/ntc_table_test.c.o" "gcc" "CMakeFiles/ntc_table_test.dir/ntc_table_test.c.o.d"
+  "/root/repo/BSP/heat.c" "CMakeFiles/ntc_table_test.dir/root/repo/BSP/heat.c.o" "gcc" "CMakeFiles/ntc_table_test.dir/root/repo/BSP/heat.c.o.d"
+  "/root/repo/BSP/ntc.c" "CMakeFiles/ntc_table_test.dir/root/repo/BSP/ntc.c.o" "gcc" "CMakeFiles/ntc_table_test.dir/root/repo/BSP/ntc.c.o.d"
+  "/root/repo/Tools/filter.c" "CMakeFiles/ntc_table_test.dir/root/repo/Tools/filter.c.o" "gcc" "CMakeFiles/ntc_table_test.dir/root/repo/Tools/filter.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/test/CMakeFiles/host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
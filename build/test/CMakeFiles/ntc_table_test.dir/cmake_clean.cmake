@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ntc_table_test.dir/ntc_table_test.c.o"
+  "CMakeFiles/ntc_table_test.dir/ntc_table_test.c.o.d"
+  "CMakeFiles/ntc_table_test.dir/root/repo/BSP/heat.c.o"
+  "CMakeFiles/ntc_table_test.dir/root/repo/BSP/heat.c.o.d"
+  "CMakeFiles/ntc_table_test.dir/root/repo/BSP/ntc.c.o"
+  "CMakeFiles/ntc_table_test.dir/root/repo/BSP/ntc.c.o.d"
+  "CMakeFiles/ntc_table_test.dir/root/repo/Tools/filter.c.o"
+  "CMakeFiles/ntc_table_test.dir/root/repo/Tools/filter.c.o.d"
+  "ntc_table_test"
+  "ntc_table_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ntc_table_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Test/pid_q_test.c" "CMakeFiles/pid_q_test.dir/pid_q_test.c.o" "gcc" "CMakeFiles/pid_q_test.dir/pid_q_test.c.o.d"
+  "/root/repo/Tools/pid.c" "CMakeFiles/pid_q_test.dir/root/repo/Tools/pid.c.o" "gcc" "CMakeFiles/pid_q_test.dir/root/repo/Tools/pid.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/test/CMakeFiles/host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Core/Src/rtc.c" "CMakeFiles/rtc_calendar_test.dir/root/repo/Core/Src/rtc.c.o" "gcc" "CMakeFiles/rtc_calendar_test.dir/root/repo/Core/Src/rtc.c.o.d"
+  "/root/repo/Test/rtc_calendar_test.c" "CMakeFiles/rtc_calendar_test.dir/rtc_calendar_test.c.o" "gcc" "CMakeFiles/rtc_calendar_test.dir/rtc_calendar_test.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/test/CMakeFiles/host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
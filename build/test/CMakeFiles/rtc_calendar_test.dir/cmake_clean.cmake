@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtc_calendar_test.dir/root/repo/Core/Src/rtc.c.o"
+  "CMakeFiles/rtc_calendar_test.dir/root/repo/Core/Src/rtc.c.o.d"
+  "CMakeFiles/rtc_calendar_test.dir/rtc_calendar_test.c.o"
+  "CMakeFiles/rtc_calendar_test.dir/rtc_calendar_test.c.o.d"
+  "rtc_calendar_test"
+  "rtc_calendar_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rtc_calendar_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
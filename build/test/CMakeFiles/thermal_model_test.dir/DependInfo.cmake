@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Tools/thermal_model.c" "CMakeFiles/thermal_model_test.dir/root/repo/Tools/thermal_model.c.o" "gcc" "CMakeFiles/thermal_model_test.dir/root/repo/Tools/thermal_model.c.o.d"
+  "/root/repo/Test/thermal_model_test.c" "CMakeFiles/thermal_model_test.dir/thermal_model_test.c.o" "gcc" "CMakeFiles/thermal_model_test.dir/thermal_model_test.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/test/CMakeFiles/host.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,26 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Test
+# Build directory: /root/repo/build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[alarm_sim]=] "/root/repo/build/test/alarm_sim" "--quiet")
+set_tests_properties([=[alarm_sim]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Test/CMakeLists.txt;62;add_test;/root/repo/Test/CMakeLists.txt;0;")
+add_test([=[rtc_calendar_test]=] "/root/repo/build/test/rtc_calendar_test")
+set_tests_properties([=[rtc_calendar_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Test/CMakeLists.txt;70;add_test;/root/repo/Test/CMakeLists.txt;0;")
+add_test([=[timestamp_test]=] "/root/repo/build/test/timestamp_test")
+set_tests_properties([=[timestamp_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Test/CMakeLists.txt;79;add_test;/root/repo/Test/CMakeLists.txt;0;")
+add_test([=[pid_q_test]=] "/root/repo/build/test/pid_q_test")
+set_tests_properties([=[pid_q_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Test/CMakeLists.txt;87;add_test;/root/repo/Test/CMakeLists.txt;0;")
+add_test([=[filter_test]=] "/root/repo/build/test/filter_test")
+set_tests_properties([=[filter_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Test/CMakeLists.txt;95;add_test;/root/repo/Test/CMakeLists.txt;0;")
+add_test([=[thermal_model_test]=] "/root/repo/build/test/thermal_model_test")
+set_tests_properties([=[thermal_model_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Test/CMakeLists.txt;103;add_test;/root/repo/Test/CMakeLists.txt;0;")
+add_test([=[heat_sim]=] "/root/repo/build/test/heat_sim")
+set_tests_properties([=[heat_sim]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Test/CMakeLists.txt;112;add_test;/root/repo/Test/CMakeLists.txt;0;")
+add_test([=[heat_sim_autotune]=] "/root/repo/build/test/heat_sim" "--autotune")
+set_tests_properties([=[heat_sim_autotune]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Test/CMakeLists.txt;113;add_test;/root/repo/Test/CMakeLists.txt;0;")
+add_test([=[ntc_table_test]=] "/root/repo/build/test/ntc_table_test")
+set_tests_properties([=[ntc_table_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Test/CMakeLists.txt;123;add_test;/root/repo/Test/CMakeLists.txt;0;")
+add_test([=[ntc_table_gen]=] "/root/.pyenv/shims/python3" "/root/repo/Test/../Tools/ntc_table_gen.py" "--check")
+set_tests_properties([=[ntc_table_gen]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Test/CMakeLists.txt;128;add_test;/root/repo/Test/CMakeLists.txt;0;")